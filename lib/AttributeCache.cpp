@@ -0,0 +1,270 @@
+#include "AttributeCache.h"
+
+#include "otairedis.h"
+
+#include "meta/otai_serialize.h"
+#include "meta/OtaiAttributeList.h"
+
+#include "swss/logger.h"
+
+#include <vector>
+
+using namespace otairedis;
+using namespace otaimeta;
+
+#define MUTEX std::lock_guard<std::mutex> _lock(m_mutex);
+
+AttributeCache::AttributeCache():
+    m_enabled(false),
+    m_ttl(OTAI_REDIS_DEFAULT_ATTRIBUTE_CACHE_TTL),
+    m_hits(0),
+    m_misses(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void AttributeCache::setEnabled(
+        _In_ bool enabled)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    m_enabled = enabled;
+
+    if (!enabled)
+    {
+        m_cache.clear();
+    }
+}
+
+bool AttributeCache::isEnabled() const
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    return m_enabled;
+}
+
+void AttributeCache::setTtl(
+        _In_ uint32_t ttlMs)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    m_ttl = std::chrono::milliseconds(ttlMs);
+}
+
+bool AttributeCache::isStaticAttribute(
+        _In_ const otai_attr_metadata_t* meta)
+{
+    SWSS_LOG_ENTER();
+
+    if (OTAI_HAS_FLAG_CREATE_ONLY(meta->flags))
+    {
+        return true;
+    }
+
+    if (!OTAI_HAS_FLAG_READ_ONLY(meta->flags))
+    {
+        return false;
+    }
+
+    // read only attributes describing hardware identity, they will not change
+    // until object is removed or linecard state changes
+
+    static const char* suffixes[] = {
+        "_SERIAL_NO",
+        "_PART_NO",
+        "_MFG_NAME",
+        "_MFG_DATE",
+        "_HARDWARE_VERSION",
+    };
+
+    std::string name = meta->attridname;
+
+    for (auto suffix: suffixes)
+    {
+        std::string s = suffix;
+
+        if (name.size() > s.size() && name.compare(name.size() - s.size(), s.size(), s) == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool AttributeCache::get(
+        _In_ otai_object_type_t objectType,
+        _In_ otai_object_id_t objectId,
+        _In_ uint32_t attr_count,
+        _Inout_ otai_attribute_t *attr_list)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    if (!m_enabled)
+    {
+        return false;
+    }
+
+    auto it = m_cache.find(objectId);
+
+    if (it == m_cache.end())
+    {
+        m_misses++;
+
+        return false;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    for (uint32_t idx = 0; idx < attr_count; idx++)
+    {
+        auto entry = it->second.find(attr_list[idx].id);
+
+        if (entry == it->second.end())
+        {
+            m_misses++;
+
+            return false;
+        }
+
+        if (!entry->second.m_static && entry->second.m_expire <= now)
+        {
+            it->second.erase(entry);
+
+            m_misses++;
+
+            return false;
+        }
+
+        auto meta = otai_metadata_get_attr_metadata(objectType, attr_list[idx].id);
+
+        if (meta == NULL)
+        {
+            m_misses++;
+
+            return false;
+        }
+
+        values.emplace_back(otai_serialize_attr_id(*meta), entry->second.m_value);
+    }
+
+    OtaiAttributeList list(objectType, values, false);
+
+    auto status = transfer_attributes(objectType, attr_count, list.get_attr_list(), attr_list, false);
+
+    if (status != OTAI_STATUS_SUCCESS)
+    {
+        // most likely user list is too small, let syncd report it
+
+        m_misses++;
+
+        return false;
+    }
+
+    m_hits++;
+
+    return true;
+}
+
+void AttributeCache::insert(
+        _In_ otai_object_type_t objectType,
+        _In_ otai_object_id_t objectId,
+        _In_ uint32_t attr_count,
+        _In_ const otai_attribute_t *attr_list)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    if (!m_enabled)
+    {
+        return;
+    }
+
+    auto expire = std::chrono::steady_clock::now() + m_ttl;
+
+    auto& attrs = m_cache[objectId];
+
+    for (uint32_t idx = 0; idx < attr_count; idx++)
+    {
+        auto meta = otai_metadata_get_attr_metadata(objectType, attr_list[idx].id);
+
+        if (meta == NULL)
+        {
+            continue;
+        }
+
+        CacheEntry entry;
+
+        entry.m_value = otai_serialize_attr_value(*meta, attr_list[idx], false);
+        entry.m_static = isStaticAttribute(meta);
+        entry.m_expire = expire;
+
+        attrs[attr_list[idx].id] = entry;
+    }
+}
+
+void AttributeCache::invalidate(
+        _In_ otai_object_id_t objectId,
+        _In_ otai_attr_id_t attrId)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    auto it = m_cache.find(objectId);
+
+    if (it != m_cache.end())
+    {
+        it->second.erase(attrId);
+    }
+}
+
+void AttributeCache::invalidate(
+        _In_ otai_object_id_t objectId)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    m_cache.erase(objectId);
+}
+
+void AttributeCache::clear()
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    m_cache.clear();
+}
+
+uint64_t AttributeCache::getHits() const
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    return m_hits;
+}
+
+uint64_t AttributeCache::getMisses() const
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    return m_misses;
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+extern "C" {
+#include "otaimetadata.h"
+}
+
+#include "swss/sal.h"
+
+#include <string>
+#include <map>
+#include <unordered_map>
+#include <mutex>
+#include <chrono>
+
+namespace otairedis
+{
+    /**
+     * @brief Client side attribute cache.
+     *
+     * Holds values returned by successful GET operations, so next GET of the
+     * same attributes will not go to syncd. Create only attributes and read
+     * only static attributes (inventory information like serial number) are
+     * cached until invalidated, all other attributes expire after TTL.
+     */
+    class AttributeCache
+    {
+        public:
+
+            AttributeCache();
+
+            virtual ~AttributeCache() = default;
+
+        public:
+
+            void setEnabled(
+                    _In_ bool enabled);
+
+            bool isEnabled() const;
+
+            void setTtl(
+                    _In_ uint32_t ttlMs);
+
+            /**
+             * @brief Get attributes from cache.
+             *
+             * Returns true only when all attributes were found in cache and
+             * successfully transferred to user buffers. Otherwise user
+             * attributes are not modified and call is counted as miss.
+             */
+            bool get(
+                    _In_ otai_object_type_t objectType,
+                    _In_ otai_object_id_t objectId,
+                    _In_ uint32_t attr_count,
+                    _Inout_ otai_attribute_t *attr_list);
+
+            /**
+             * @brief Insert attributes returned by successful GET.
+             */
+            void insert(
+                    _In_ otai_object_type_t objectType,
+                    _In_ otai_object_id_t objectId,
+                    _In_ uint32_t attr_count,
+                    _In_ const otai_attribute_t *attr_list);
+
+            void invalidate(
+                    _In_ otai_object_id_t objectId,
+                    _In_ otai_attr_id_t attrId);
+
+            void invalidate(
+                    _In_ otai_object_id_t objectId);
+
+            void clear();
+
+            uint64_t getHits() const;
+
+            uint64_t getMisses() const;
+
+        private:
+
+            static bool isStaticAttribute(
+                    _In_ const otai_attr_metadata_t* meta);
+
+        private:
+
+            typedef struct _CacheEntry
+            {
+                std::string m_value;
+
+                bool m_static;
+
+                std::chrono::steady_clock::time_point m_expire;
+
+            } CacheEntry;
+
+            mutable std::mutex m_mutex;
+
+            bool m_enabled;
+
+            std::chrono::milliseconds m_ttl;
+
+            std::unordered_map<otai_object_id_t, std::map<otai_attr_id_t, CacheEntry>> m_cache;
+
+            uint64_t m_hits;
+
+            uint64_t m_misses;
+    };
+}
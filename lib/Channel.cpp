@@ -9,7 +9,8 @@ using namespace otairedis;
 Channel::Channel(
         _In_ Callback callback):
     m_callback(callback),
-    m_responseTimeoutMs(OTAI_REDIS_DEFAULT_SYNC_OPERATION_RESPONSE_TIMEOUT)
+    m_responseTimeoutMs(OTAI_REDIS_DEFAULT_SYNC_OPERATION_RESPONSE_TIMEOUT),
+    m_notificationBacklog(0)
 {
     SWSS_LOG_ENTER();
 
@@ -37,3 +38,10 @@ uint64_t Channel::getResponseTimeout() const
 
     return m_responseTimeoutMs;
 }
+
+uint64_t Channel::getNotificationBacklog() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_notificationBacklog;
+}
@@ -12,6 +12,7 @@ extern "C" {
 
 #include <memory>
 #include <functional>
+#include <atomic>
 
 namespace otairedis
 {
@@ -19,7 +20,14 @@ namespace otairedis
     {
         public:
 
-            typedef std::function<void(const std::string&,const std::string&, const std::vector<swss::FieldValueTuple>&)> Callback;
+            /**
+             * @brief Notification callback.
+             *
+             * Called with batch of notifications received at once, each
+             * notification is represented as (serialized notification,
+             * notification name, values).
+             */
+            typedef std::function<void(const std::vector<swss::KeyOpFieldsValuesTuple>&)> Callback;
 
         public:
 
@@ -35,6 +43,12 @@ namespace otairedis
 
             uint64_t getResponseTimeout() const;
 
+            /**
+             * @brief Get number of notifications received from redis and
+             * queued behind batch which is being dispatched.
+             */
+            uint64_t getNotificationBacklog() const;
+
         public:
 
             virtual void setBuffered(
@@ -42,19 +56,45 @@ namespace otairedis
 
             virtual void flush() = 0;
 
-            virtual void set(
+            /**
+             * @brief Send request.
+             *
+             * Returns request id which should be used to wait for response.
+             * Can be called from multiple threads.
+             */
+            virtual uint64_t set(
                     _In_ const std::string& key, 
                     _In_ const std::vector<swss::FieldValueTuple>& values,
                     _In_ const std::string& command) = 0;
 
-            virtual void del(
+            virtual uint64_t del(
                     _In_ const std::string& key,
                     _In_ const std::string& command) = 0;
 
+            /**
+             * @brief Wait for response on given request.
+             *
+             * Multiple threads can wait for their own requests at the same
+             * time.
+             */
             virtual otai_status_t wait(
                     _In_ const std::string& command,
+                    _In_ uint64_t requestId,
                     _Out_ swss::KeyOpFieldsValuesTuple& kco) = 0;
 
+            /**
+             * @brief Wait for multiple responses.
+             *
+             * Used in pipeline mode, where multiple requests were sent
+             * without waiting for response. Responses are returned in the
+             * same order as request ids. When not all responses arrived in
+             * time, remaining ones are abandoned and failure is returned.
+             */
+            virtual otai_status_t waitForResponses(
+                    _In_ const std::string& command,
+                    _In_ const std::vector<uint64_t>& requestIds,
+                    _Out_ std::vector<swss::KeyOpFieldsValuesTuple>& kcos) = 0;
+
         protected:
 
             virtual void notificationThreadFunction() = 0;
@@ -81,5 +121,10 @@ namespace otairedis
              * @brief Notification thread
              */
             std::shared_ptr<std::thread> m_notificationThread;
+
+            /**
+             * @brief Depth of notification consumer queue.
+             */
+            std::atomic<uint64_t> m_notificationBacklog;
     };
 }
@@ -6,14 +6,17 @@ using namespace otairedis;
 using namespace std::placeholders;
 
 Context::Context(
-        _In_ std::function<otai_linecard_notifications_t(std::shared_ptr<Notification>, Context*)> notificationCallback):
+        _In_ std::shared_ptr<ContextConfig> contextConfig,
+        _In_ std::function<std::vector<otai_linecard_notifications_t>(const std::vector<std::shared_ptr<Notification>>&, Context*)> notificationCallback):
+    m_contextConfig(contextConfig),
     m_notificationCallback(notificationCallback)
 {
     SWSS_LOG_ENTER();
 
     // will create notification thread
     m_redisOtai = std::make_shared<RedisRemoteOtaiInterface>(
-            std::bind(&Context::handle_notification, this, _1));
+            m_contextConfig,
+            std::bind(&Context::handle_notifications, this, _1));
 
     m_meta = std::make_shared<otaimeta::Meta>(m_redisOtai);
 
@@ -31,11 +34,11 @@ Context::~Context()
     m_meta = nullptr;
 }
 
-otai_linecard_notifications_t Context::handle_notification(
-        _In_ std::shared_ptr<Notification> notification)
+std::vector<otai_linecard_notifications_t> Context::handle_notifications(
+        _In_ const std::vector<std::shared_ptr<Notification>>& notifications)
 {
     SWSS_LOG_ENTER();
 
-    return m_notificationCallback(notification, this);
+    return m_notificationCallback(notifications, this);
 }
 
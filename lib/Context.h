@@ -1,6 +1,7 @@
 #pragma once
 
 #include "RedisRemoteOtaiInterface.h"
+#include "ContextConfig.h"
 
 #include "meta/Notification.h"
 #include "meta/Meta.h"
@@ -12,21 +13,24 @@ namespace otairedis
         public:
 
             Context(
-                    _In_ std::function<otai_linecard_notifications_t(std::shared_ptr<Notification>, Context*)> notificationCallback);
+                    _In_ std::shared_ptr<ContextConfig> contextConfig,
+                    _In_ std::function<std::vector<otai_linecard_notifications_t>(const std::vector<std::shared_ptr<Notification>>&, Context*)> notificationCallback);
 
             virtual ~Context();
 
         private:
 
-            otai_linecard_notifications_t handle_notification(
-                    _In_ std::shared_ptr<Notification> notification);
+            std::vector<otai_linecard_notifications_t> handle_notifications(
+                    _In_ const std::vector<std::shared_ptr<Notification>>& notifications);
 
         public:
 
+            std::shared_ptr<ContextConfig> m_contextConfig;
+
             std::shared_ptr<otaimeta::Meta> m_meta;
 
             std::shared_ptr<RedisRemoteOtaiInterface> m_redisOtai;
 
-            std::function<otai_linecard_notifications_t(std::shared_ptr<Notification>, Context*)> m_notificationCallback;
+            std::function<std::vector<otai_linecard_notifications_t>(const std::vector<std::shared_ptr<Notification>>&, Context*)> m_notificationCallback;
     };
 }
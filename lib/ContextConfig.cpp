@@ -0,0 +1,54 @@
+#include "ContextConfig.h"
+
+#include "swss/logger.h"
+
+using namespace otairedis;
+
+ContextConfig::ContextConfig(
+        _In_ uint32_t guid,
+        _In_ const std::string& name,
+        _In_ const std::string& dbAsic,
+        _In_ const std::string& dbCounters,
+        _In_ const std::string& dbState,
+        _In_ const std::string& dbFlex,
+        _In_ const std::string& dbHistory):
+    m_guid(guid),
+    m_name(name),
+    m_dbAsic(dbAsic),
+    m_dbCounters(dbCounters),
+    m_dbState(dbState),
+    m_dbFlex(dbFlex),
+    m_dbHistory(dbHistory)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+bool ContextConfig::insert(
+        _In_ uint32_t linecardIndex,
+        _In_ const std::string& hardwareInfo)
+{
+    SWSS_LOG_ENTER();
+
+    if (hasLinecardIndex(linecardIndex))
+    {
+        SWSS_LOG_ERROR("linecard index %u already present in context %s",
+                linecardIndex,
+                m_name.c_str());
+
+        return false;
+    }
+
+    m_linecards[linecardIndex] = hardwareInfo;
+
+    return true;
+}
+
+bool ContextConfig::hasLinecardIndex(
+        _In_ uint32_t linecardIndex) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_linecards.find(linecardIndex) != m_linecards.end();
+}
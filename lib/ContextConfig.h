@@ -0,0 +1,68 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <string>
+#include <map>
+#include <cstdint>
+
+namespace otairedis
+{
+    /**
+     * @brief Context configuration.
+     *
+     * Describes single context (syncd instance) and linecards it manages.
+     * Linecard index is encoded in every VID, and it's used to route API
+     * calls to proper context, so linecard indexes must be unique globally.
+     */
+    class ContextConfig
+    {
+        public:
+
+            ContextConfig(
+                    _In_ uint32_t guid,
+                    _In_ const std::string& name,
+                    _In_ const std::string& dbAsic,
+                    _In_ const std::string& dbCounters,
+                    _In_ const std::string& dbState,
+                    _In_ const std::string& dbFlex,
+                    _In_ const std::string& dbHistory);
+
+            virtual ~ContextConfig() = default;
+
+        public:
+
+            /**
+             * @brief Insert linecard configuration.
+             *
+             * Returns false if linecard index is already present.
+             */
+            bool insert(
+                    _In_ uint32_t linecardIndex,
+                    _In_ const std::string& hardwareInfo);
+
+            bool hasLinecardIndex(
+                    _In_ uint32_t linecardIndex) const;
+
+        public:
+
+            uint32_t m_guid;
+
+            std::string m_name;
+
+            std::string m_dbAsic;
+
+            std::string m_dbCounters;
+
+            std::string m_dbState;
+
+            std::string m_dbFlex;
+
+            std::string m_dbHistory;
+
+            /**
+             * @brief Linecard index to hardware info map.
+             */
+            std::map<uint32_t, std::string> m_linecards;
+    };
+}
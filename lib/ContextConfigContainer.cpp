@@ -0,0 +1,217 @@
+#include "ContextConfigContainer.h"
+#include "otairediscommon.h"
+
+#include "swss/logger.h"
+
+#include "nlohmann/json.hpp"
+
+#include <cstring>
+#include <cerrno>
+#include <fstream>
+
+using namespace otairedis;
+using json = nlohmann::json;
+
+/*
+ * Linecard index is encoded on 8 bits of VID.
+ */
+#define CONTEXT_CONFIG_LINECARD_INDEX_MAX (0xff)
+
+ContextConfigContainer::ContextConfigContainer()
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void ContextConfigContainer::insert(
+        _In_ std::shared_ptr<ContextConfig> contextConfig)
+{
+    SWSS_LOG_ENTER();
+
+    m_map[contextConfig->m_guid] = contextConfig;
+}
+
+std::shared_ptr<ContextConfig> ContextConfigContainer::get(
+        _In_ uint32_t guid) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_map.find(guid);
+
+    if (it == m_map.end())
+    {
+        return nullptr;
+    }
+
+    return it->second;
+}
+
+std::shared_ptr<ContextConfig> ContextConfigContainer::getByLinecardIndex(
+        _In_ uint32_t linecardIndex) const
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& kvp: m_map)
+    {
+        if (kvp.second->hasLinecardIndex(linecardIndex))
+        {
+            return kvp.second;
+        }
+    }
+
+    return nullptr;
+}
+
+std::set<std::shared_ptr<ContextConfig>> ContextConfigContainer::getAllContextConfigs() const
+{
+    SWSS_LOG_ENTER();
+
+    std::set<std::shared_ptr<ContextConfig>> set;
+
+    for (auto& kvp: m_map)
+    {
+        set.insert(kvp.second);
+    }
+
+    return set;
+}
+
+std::shared_ptr<ContextConfigContainer> ContextConfigContainer::getDefault()
+{
+    SWSS_LOG_ENTER();
+
+    auto ccc = std::make_shared<ContextConfigContainer>();
+
+    auto cc = std::make_shared<ContextConfig>(
+            0,
+            "otairedis",
+            REDIS_DEFAULT_DATABASE_ASIC,
+            REDIS_DEFAULT_DATABASE_COUNTERS,
+            REDIS_DEFAULT_DATABASE_STATE,
+            REDIS_DEFAULT_DATABASE_FLEX_COUNTER,
+            REDIS_DEFAULT_DATABASE_HISTORY);
+
+    cc->insert(0, "");
+
+    ccc->insert(cc);
+
+    return ccc;
+}
+
+std::shared_ptr<ContextConfigContainer> ContextConfigContainer::loadFromFile(
+        _In_ const char* contextConfig)
+{
+    SWSS_LOG_ENTER();
+
+    auto ccc = std::make_shared<ContextConfigContainer>();
+
+    if (contextConfig == nullptr || strlen(contextConfig) == 0)
+    {
+        SWSS_LOG_NOTICE("no context config specified, will load default context config");
+
+        return getDefault();
+    }
+
+    std::ifstream ifs(contextConfig);
+
+    if (!ifs.good())
+    {
+        SWSS_LOG_ERROR("failed to read '%s', err: %s, returning default", contextConfig, strerror(errno));
+
+        return getDefault();
+    }
+
+    try
+    {
+        json j;
+        ifs >> j;
+
+        std::set<uint32_t> linecardIndexes;
+
+        for (size_t idx = 0; idx < j["CONTEXTS"].size(); idx++)
+        {
+            json& item = j["CONTEXTS"][idx];
+
+            uint32_t guid = item["guid"];
+
+            if (ccc->get(guid))
+            {
+                SWSS_LOG_THROW("context guid %u is defined more than once", guid);
+            }
+
+            const std::string& name = item["name"];
+
+            const std::string& dbAsic = item["dbAsic"];
+            const std::string& dbCounters = item["dbCounters"];
+            const std::string& dbState = item["dbState"];
+
+            // flex counter and history databases are optional
+
+            std::string dbFlex = item.value("dbFlex", std::string(REDIS_DEFAULT_DATABASE_FLEX_COUNTER));
+            std::string dbHistory = item.value("dbHistory", std::string(REDIS_DEFAULT_DATABASE_HISTORY));
+
+            SWSS_LOG_NOTICE("contextConfig: %u, %s, %s, %s, %s, %s, %s",
+                    guid,
+                    name.c_str(),
+                    dbAsic.c_str(),
+                    dbCounters.c_str(),
+                    dbState.c_str(),
+                    dbFlex.c_str(),
+                    dbHistory.c_str());
+
+            auto cc = std::make_shared<ContextConfig>(guid, name, dbAsic, dbCounters, dbState, dbFlex, dbHistory);
+
+            for (size_t k = 0; k < item["linecards"].size(); k++)
+            {
+                json& linecard = item["linecards"][k];
+
+                uint32_t linecardIndex = linecard["index"];
+
+                if (linecardIndex > CONTEXT_CONFIG_LINECARD_INDEX_MAX)
+                {
+                    SWSS_LOG_THROW("linecard index %u in context %s is out of range, max is %u",
+                            linecardIndex,
+                            name.c_str(),
+                            CONTEXT_CONFIG_LINECARD_INDEX_MAX);
+                }
+
+                if (linecardIndexes.find(linecardIndex) != linecardIndexes.end())
+                {
+                    // linecard index is used to route API calls, so it must
+                    // point to exactly one context
+
+                    SWSS_LOG_THROW("linecard index %u is defined in more than one context", linecardIndex);
+                }
+
+                const std::string& hwinfo = linecard["hwinfo"];
+
+                cc->insert(linecardIndex, hwinfo);
+
+                linecardIndexes.insert(linecardIndex);
+
+                SWSS_LOG_NOTICE("linecardConfig: %u, %s", linecardIndex, hwinfo.c_str());
+            }
+
+            if (cc->m_linecards.empty())
+            {
+                SWSS_LOG_THROW("context %s has no linecards defined", name.c_str());
+            }
+
+            ccc->insert(cc);
+        }
+
+        if (ccc->m_map.empty())
+        {
+            SWSS_LOG_THROW("no contexts defined in %s", contextConfig);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("Failed to load '%s': %s, returning default", contextConfig, e.what());
+
+        return getDefault();
+    }
+
+    return ccc;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "ContextConfig.h"
+
+#include <memory>
+#include <map>
+#include <set>
+
+namespace otairedis
+{
+    class ContextConfigContainer
+    {
+        public:
+
+            ContextConfigContainer();
+
+            virtual ~ContextConfigContainer() = default;
+
+        public:
+
+            void insert(
+                    _In_ std::shared_ptr<ContextConfig> contextConfig);
+
+            std::shared_ptr<ContextConfig> get(
+                    _In_ uint32_t guid) const;
+
+            /**
+             * @brief Get context which manages given linecard index.
+             *
+             * Returns nullptr if linecard index is not configured.
+             */
+            std::shared_ptr<ContextConfig> getByLinecardIndex(
+                    _In_ uint32_t linecardIndex) const;
+
+            std::set<std::shared_ptr<ContextConfig>> getAllContextConfigs() const;
+
+        public:
+
+            /**
+             * @brief Get default configuration.
+             *
+             * Single context with guid 0 on ASIC_DB managing linecard index 0.
+             */
+            static std::shared_ptr<ContextConfigContainer> getDefault();
+
+            /**
+             * @brief Load context configuration from json file.
+             *
+             * If file is not specified or it's invalid, default
+             * configuration is returned.
+             */
+            static std::shared_ptr<ContextConfigContainer> loadFromFile(
+                    _In_ const char* contextConfig);
+
+        private:
+
+            std::map<uint32_t, std::shared_ptr<ContextConfig>> m_map;
+    };
+}
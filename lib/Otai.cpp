@@ -13,6 +13,13 @@ using namespace std::placeholders;
         SWSS_LOG_ERROR("%s: api not initialized", __PRETTY_FUNCTION__);     \
         return OTAI_STATUS_FAILURE; }
 
+#define REDIS_CHECK_CONTEXT(oid)                                            \
+    auto context = getContextByObjectId(oid);                               \
+    if (context == nullptr) {                                               \
+        SWSS_LOG_ERROR("no context found for object %s",                    \
+                otai_serialize_object_id(oid).c_str());                     \
+        return OTAI_STATUS_FAILURE; }
+
 Otai::Otai()
 {
     SWSS_LOG_ENTER();
@@ -64,7 +71,18 @@ otai_status_t Otai::initialize(
 
     memcpy(&m_service_method_table, service_method_table, sizeof(m_service_method_table));
 
-    m_context = std::make_shared<Context>(std::bind(&Otai::handle_notification, this, _1, _2));
+    auto contextConfig = service_method_table->profile_get_value(0, OTAI_REDIS_KEY_CONTEXT_CONFIG);
+
+    m_contextConfigContainer = ContextConfigContainer::loadFromFile(contextConfig);
+
+    m_contextMap.clear();
+
+    for (auto& cc: m_contextConfigContainer->getAllContextConfigs())
+    {
+        // each context has its own channel to its syncd
+
+        m_contextMap[cc->m_guid] = std::make_shared<Context>(cc, std::bind(&Otai::handle_notifications, this, _1, _2));
+    }
 
     m_apiInitialized = true;
 
@@ -99,29 +117,82 @@ otai_status_t Otai::create(
         _In_ uint32_t attr_count,
         _In_ const otai_attribute_t *attr_list)
 {
-    MUTEX();
+    MUTEX_OBJECT_TYPE(objectType);
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
-    auto status = m_context->m_meta->create(
+    if (objectType == OTAI_OBJECT_TYPE_LINECARD)
+    {
+        // linecard VID is not known yet, context is selected by optional
+        // context attribute, which is removed from list passed to syncd
+
+        uint32_t globalContext = m_contextMap.begin()->first;
+
+        std::vector<otai_attribute_t> attrs;
+
+        bool hasContext = false;
+
+        for (uint32_t idx = 0; attr_list && idx < attr_count; idx++)
+        {
+            if (attr_list[idx].id != OTAI_REDIS_LINECARD_ATTR_CONTEXT)
+            {
+                attrs.push_back(attr_list[idx]);
+
+                continue;
+            }
+
+            if (hasContext)
+            {
+                SWSS_LOG_ERROR("context attribute passed more than once");
+
+                return OTAI_STATUS_INVALID_PARAMETER;
+            }
+
+            hasContext = true;
+
+            globalContext = attr_list[idx].value.u32;
+        }
+
+        auto context = getContext(globalContext);
+
+        if (context == nullptr)
+        {
+            SWSS_LOG_ERROR("context %u is not configured", globalContext);
+
+            return OTAI_STATUS_FAILURE;
+        }
+
+        SWSS_LOG_NOTICE("creating linecard in context %s",
+                context->m_contextConfig->m_name.c_str());
+
+        return context->m_meta->create(
+                objectType,
+                objectId,
+                linecardId,
+                attr_list ? (uint32_t)attrs.size() : attr_count,
+                attr_list ? attrs.data() : attr_list);
+    }
+
+    REDIS_CHECK_CONTEXT(linecardId);
+
+    return context->m_meta->create(
             objectType,
             objectId,
             linecardId,
             attr_count,
             attr_list);
-
-    return status;
 }
 
 otai_status_t Otai::remove(
         _In_ otai_object_type_t objectType,
         _In_ otai_object_id_t objectId)
 {
-    MUTEX();
+    MUTEX_OBJECT_TYPE(objectType);
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
+    REDIS_CHECK_CONTEXT(objectId);
 
-    return m_context->m_meta->remove(objectType, objectId);
+    return context->m_meta->remove(objectType, objectId);
 }
 
 otai_status_t Otai::set(
@@ -129,7 +200,7 @@ otai_status_t Otai::set(
         _In_ otai_object_id_t objectId,
         _In_ const otai_attribute_t *attr)
 {
-    MUTEX();
+    MUTEX_OBJECT_TYPE(objectType);
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
@@ -137,23 +208,35 @@ otai_status_t Otai::set(
     {
         // skip metadata if attribute is redis extension attribute
 
-        // TODO this is setting on all contexts, but maybe we want one specific?
-        // and do set on all if objectId == NULL
+        if (objectId != OTAI_NULL_OBJECT_ID)
+        {
+            REDIS_CHECK_CONTEXT(objectId);
+
+            return context->m_redisOtai->set(objectType, objectId, attr);
+        }
+
+        // no object specified, set on all contexts
 
         bool success = true;
 
-        otai_status_t status = m_context->m_redisOtai->set(objectType, objectId, attr);
+        for (auto& kvp: m_contextMap)
+        {
+            otai_status_t status = kvp.second->m_redisOtai->set(objectType, objectId, attr);
 
-        success &= (status == OTAI_STATUS_SUCCESS);
+            success &= (status == OTAI_STATUS_SUCCESS);
 
-        SWSS_LOG_INFO("setting attribute 0x%x status: %s",
-                attr->id,
-                otai_serialize_status(status).c_str());
+            SWSS_LOG_INFO("setting attribute 0x%x on context %s status: %s",
+                    attr->id,
+                    kvp.second->m_contextConfig->m_name.c_str(),
+                    otai_serialize_status(status).c_str());
+        }
 
         return success ? OTAI_STATUS_SUCCESS : OTAI_STATUS_FAILURE;
     }
 
-    return m_context->m_meta->set(objectType, objectId, attr);
+    REDIS_CHECK_CONTEXT(objectId);
+
+    return context->m_meta->set(objectType, objectId, attr);
 }
 
 otai_status_t Otai::get(
@@ -162,11 +245,33 @@ otai_status_t Otai::get(
         _In_ uint32_t attr_count,
         _Inout_ otai_attribute_t *attr_list)
 {
-    MUTEX();
+    MUTEX_SHARED();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
-    return m_context->m_meta->get(
+    if (attr_count && RedisRemoteOtaiInterface::isRedisAttribute(objectType, attr_list))
+    {
+        // skip metadata if attribute is redis extension attribute, when no
+        // object is specified, default context is used
+
+        auto context = (objectId == OTAI_NULL_OBJECT_ID)
+            ? m_contextMap.begin()->second
+            : getContextByObjectId(objectId);
+
+        if (context == nullptr)
+        {
+            SWSS_LOG_ERROR("no context found for object %s",
+                    otai_serialize_object_id(objectId).c_str());
+
+            return OTAI_STATUS_FAILURE;
+        }
+
+        return context->m_redisOtai->get(objectType, objectId, attr_count, attr_list);
+    }
+
+    REDIS_CHECK_CONTEXT(objectId);
+
+    return context->m_meta->get(
             objectType,
             objectId,
             attr_count,
@@ -184,11 +289,12 @@ otai_status_t Otai::getStats(
         _In_ const otai_stat_id_t *counter_ids,
         _Out_ otai_stat_value_t *counters)
 {
-    MUTEX();
+    MUTEX_SHARED();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
+    REDIS_CHECK_CONTEXT(object_id);
 
-    return m_context->m_meta->getStats(
+    return context->m_meta->getStats(
             object_type,
             object_id,
             number_of_counters,
@@ -204,11 +310,12 @@ otai_status_t Otai::getStatsExt(
         _In_ otai_stats_mode_t mode,
         _Out_ otai_stat_value_t *counters)
 {
-    MUTEX();
+    MUTEX_SHARED();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
+    REDIS_CHECK_CONTEXT(object_id);
 
-    return m_context->m_meta->getStatsExt(
+    return context->m_meta->getStatsExt(
             object_type,
             object_id,
             number_of_counters,
@@ -223,11 +330,12 @@ otai_status_t Otai::clearStats(
         _In_ uint32_t number_of_counters,
         _In_ const otai_stat_id_t *counter_ids)
 {
-    MUTEX();
+    MUTEX_SHARED();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
+    REDIS_CHECK_CONTEXT(object_id);
 
-    return m_context->m_meta->clearStats(
+    return context->m_meta->clearStats(
             object_type,
             object_id,
             number_of_counters,
@@ -272,7 +380,10 @@ otai_status_t Otai::logSet(
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
-    m_context->m_meta->logSet(api, log_level);
+    for (auto& kvp: m_contextMap)
+    {
+        kvp.second->m_meta->logSet(api, log_level);
+    }
 
     return OTAI_STATUS_SUCCESS;
 }
@@ -292,21 +403,32 @@ otai_status_t Otai::logSet(
  * notification can be ignored.
  */
 
-otai_linecard_notifications_t Otai::handle_notification(
-        _In_ std::shared_ptr<Notification> notification,
+std::vector<otai_linecard_notifications_t> Otai::handle_notifications(
+        _In_ const std::vector<std::shared_ptr<Notification>>& notifications,
         _In_ Context* context)
 {
-    MUTEX();
+    MUTEX_SHARED();
     SWSS_LOG_ENTER();
 
-    if (!m_apiInitialized)
+    // whole batch is processed under single api lock
+
+    std::vector<otai_linecard_notifications_t> sns;
+
+    for (auto& notification: notifications)
     {
-        SWSS_LOG_ERROR("%s: api not initialized", __PRETTY_FUNCTION__);
+        if (!m_apiInitialized)
+        {
+            SWSS_LOG_ERROR("%s: api not initialized", __PRETTY_FUNCTION__);
+
+            sns.push_back({nullptr, nullptr, nullptr, nullptr});
+
+            continue;
+        }
 
-        return {nullptr, nullptr, nullptr, nullptr};
+        sns.push_back(context->m_redisOtai->syncProcessNotification(notification));
     }
 
-    return context->m_redisOtai->syncProcessNotification(notification);
+    return sns;
 }
 
 std::shared_ptr<Context> Otai::getContext(
@@ -314,7 +436,31 @@ std::shared_ptr<Context> Otai::getContext(
 {
     SWSS_LOG_ENTER();
 
-    return m_context;
+    auto it = m_contextMap.find(globalContext);
+
+    if (it == m_contextMap.end())
+    {
+        return nullptr;
+    }
+
+    return it->second;
+}
+
+std::shared_ptr<Context> Otai::getContextByObjectId(
+        _In_ otai_object_id_t objectId)
+{
+    SWSS_LOG_ENTER();
+
+    auto linecardIndex = VirtualObjectIdManager::getLinecardIndex(objectId);
+
+    auto contextConfig = m_contextConfigContainer->getByLinecardIndex(linecardIndex);
+
+    if (contextConfig == nullptr)
+    {
+        return nullptr;
+    }
+
+    return getContext(contextConfig->m_guid);
 }
 
 std::string joinFieldValues(
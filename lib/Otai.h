@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Context.h"
+#include "ContextConfigContainer.h"
 
 #include "meta/Meta.h"
 #include "meta/Notification.h"
@@ -11,6 +12,7 @@
 #include <vector>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <map>
 
 namespace otairedis
@@ -94,20 +96,31 @@ namespace otairedis
 
         private:
 
-            otai_linecard_notifications_t handle_notification(
-                    _In_ std::shared_ptr<Notification> notification,
+            std::vector<otai_linecard_notifications_t> handle_notifications(
+                    _In_ const std::vector<std::shared_ptr<Notification>>& notifications,
                     _In_ Context* context);
 
             std::shared_ptr<Context> getContext(
                     _In_ uint32_t globalContext);
 
+            /**
+             * @brief Get context by linecard index encoded in object id.
+             *
+             * Returns nullptr if linecard index is not configured in any
+             * context.
+             */
+            std::shared_ptr<Context> getContextByObjectId(
+                    _In_ otai_object_id_t objectId);
+
         private:
 
             bool m_apiInitialized;
 
-            std::recursive_mutex m_apimutex;
+            std::shared_timed_mutex m_apimutex;
+
+            std::shared_ptr<ContextConfigContainer> m_contextConfigContainer;
 
-            std::shared_ptr<Context> m_context;
+            std::map<uint32_t, std::shared_ptr<Context>> m_contextMap;
 
             otai_service_method_table_t m_service_method_table;
     };
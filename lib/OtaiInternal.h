@@ -1,4 +1,14 @@
 #pragma once
 
-#define MUTEX() std::lock_guard<std::recursive_mutex> _lock(m_apimutex)
-#define MUTEX_UNLOCK() m_apimutex.unlock()
+/*
+ * Exclusive lock is required only by operations which are modifying client
+ * state (initialize, linecard create/remove/set, redis extension attributes),
+ * all other operations take shared lock and can run in parallel.
+ */
+
+#define MUTEX() std::unique_lock<std::shared_timed_mutex> _lock(m_apimutex)
+#define MUTEX_SHARED() std::shared_lock<std::shared_timed_mutex> _lock(m_apimutex)
+#define MUTEX_OBJECT_TYPE(ot)                                                       \
+    std::unique_lock<std::shared_timed_mutex> _ulock(m_apimutex, std::defer_lock);  \
+    std::shared_lock<std::shared_timed_mutex> _slock(m_apimutex, std::defer_lock);  \
+    if ((ot) == OTAI_OBJECT_TYPE_LINECARD) _ulock.lock(); else _slock.lock();
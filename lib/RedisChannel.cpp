@@ -1,5 +1,6 @@
 #include "RedisChannel.h"
 
+#include "Utils.h"
 #include "otairediscommon.h"
 
 #include "meta/otai_serialize.h"
@@ -7,13 +8,35 @@
 #include "swss/logger.h"
 #include "swss/select.h"
 
+#include <inttypes.h>
+#include <algorithm>
+
+/*
+ * Maximum number of notifications dispatched to callback at once.
+ */
+#define REDIS_CHANNEL_NOTIFICATION_BATCH_SIZE 256
+
 using namespace otairedis;
 
 RedisChannel::RedisChannel(
         _In_ const std::string& dbAsic,
         _In_ Channel::Callback callback):
+    RedisChannel(dbAsic, ASIC_STATE_TABLE, REDIS_TABLE_GETRESPONSE, callback)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+RedisChannel::RedisChannel(
+        _In_ const std::string& dbAsic,
+        _In_ const std::string& requestTable,
+        _In_ const std::string& responseTable,
+        _In_ Channel::Callback callback):
     Channel(callback),
-    m_dbAsic(dbAsic)
+    m_dbAsic(dbAsic),
+    m_requestId(0),
+    m_responseReaderActive(false)
 {
     SWSS_LOG_ENTER();
 
@@ -21,8 +44,8 @@ RedisChannel::RedisChannel(
 
     m_db                    = std::make_shared<swss::DBConnector>(dbAsic, 0);
     m_redisPipeline         = std::make_shared<swss::RedisPipeline>(m_db.get()); // enable default pipeline 128
-    m_asicState             = std::make_shared<swss::ProducerTable>(m_redisPipeline.get(), ASIC_STATE_TABLE, true);
-    m_getConsumer           = std::make_shared<swss::ConsumerTable>(m_db.get(), REDIS_TABLE_GETRESPONSE);
+    m_asicState             = std::make_shared<swss::ProducerTable>(m_redisPipeline.get(), requestTable, true);
+    m_getConsumer           = std::make_shared<swss::ConsumerTable>(m_db.get(), responseTable);
 
     m_dbNtf                 = std::make_shared<swss::DBConnector>(dbAsic, 0);
     m_notificationConsumer  = std::make_shared<swss::NotificationConsumer>(m_dbNtf.get(), REDIS_TABLE_NOTIFICATIONS);
@@ -91,11 +114,18 @@ void RedisChannel::notificationThreadFunction()
     s.addSelectable(m_notificationConsumer.get());
     s.addSelectable(&m_notificationThreadShouldEndEvent);
 
+    // notifications received from redis and not yet dispatched
+
+    std::deque<swss::KeyOpFieldsValuesTuple> queue;
+
     while (m_runNotificationThread)
     {
-        swss::Selectable *sel;
+        swss::Selectable *sel = nullptr;
+
+        // while notifications are queued only poll for new ones, so queue
+        // depth reflects everything which was already sent to us
 
-        int result = s.select(&sel);
+        int result = s.select(&sel, queue.empty() ? -1 : 0);
 
         if (sel == &m_notificationThreadShouldEndEvent)
         {
@@ -105,23 +135,39 @@ void RedisChannel::notificationThreadFunction()
 
         if (result == swss::Select::OBJECT)
         {
-            swss::KeyOpFieldsValuesTuple kco;
-
-            std::string op;
-            std::string data;
-            std::vector<swss::FieldValueTuple> values;
-
-            m_notificationConsumer->pop(op, data, values);
+            std::deque<swss::KeyOpFieldsValuesTuple> vkco;
 
-            SWSS_LOG_DEBUG("notification: op = %s, data = %s", op.c_str(), data.c_str());
+            m_notificationConsumer->pops(vkco);
 
-            m_callback(op, data, values);
+            queue.insert(queue.end(), vkco.begin(), vkco.end());
         }
-        else
+        else if (result != swss::Select::TIMEOUT)
         {
             SWSS_LOG_ERROR("select failed: %s", getSelectResultAsString(result).c_str());
         }
+
+        if (queue.empty())
+        {
+            continue;
+        }
+
+        // dispatch notifications in bounded batches, so during notification
+        // storm we don't fall behind by processing them one by one
+
+        size_t count = std::min(queue.size(), (size_t)REDIS_CHANNEL_NOTIFICATION_BATCH_SIZE);
+
+        std::vector<swss::KeyOpFieldsValuesTuple> batch(queue.begin(), queue.begin() + count);
+
+        queue.erase(queue.begin(), queue.begin() + count);
+
+        m_notificationBacklog = queue.size();
+
+        SWSS_LOG_DEBUG("notification batch: %zu, backlog: %zu", batch.size(), queue.size());
+
+        m_callback(batch);
     }
+
+    m_notificationBacklog = 0;
 }
 
 void RedisChannel::setBuffered(
@@ -129,6 +175,8 @@ void RedisChannel::setBuffered(
 {
     SWSS_LOG_ENTER();
 
+    std::lock_guard<std::mutex> lock(m_sendMutex);
+
     m_asicState->setBuffered(buffered);
 }
 
@@ -136,93 +184,264 @@ void RedisChannel::flush()
 {
     SWSS_LOG_ENTER();
 
+    std::lock_guard<std::mutex> lock(m_sendMutex);
+
     m_asicState->flush();
 }
 
-void RedisChannel::set(
+uint64_t RedisChannel::set(
         _In_ const std::string& key, 
         _In_ const std::vector<swss::FieldValueTuple>& values,
         _In_ const std::string& command)
 {
     SWSS_LOG_ENTER();
 
-    m_asicState->set(key, values, command);
+    std::lock_guard<std::mutex> lock(m_sendMutex);
+
+    uint64_t requestId = ++m_requestId;
+
+    {
+        // request must be awaited before it's sent, since response can
+        // arrive before caller will start waiting
+
+        std::lock_guard<std::mutex> responseLock(m_responseMutex);
+
+        m_awaitedRequests.insert(requestId);
+    }
+
+    m_asicState->set(Utils::joinRequestId(key, requestId), values, command);
+
+    return requestId;
 }
 
-void RedisChannel::del(
+uint64_t RedisChannel::del(
         _In_ const std::string& key,
         _In_ const std::string& command)
 {
     SWSS_LOG_ENTER();
 
-    m_asicState->del(key, command);
+    std::lock_guard<std::mutex> lock(m_sendMutex);
+
+    uint64_t requestId = ++m_requestId;
+
+    {
+        std::lock_guard<std::mutex> responseLock(m_responseMutex);
+
+        m_awaitedRequests.insert(requestId);
+    }
+
+    m_asicState->del(Utils::joinRequestId(key, requestId), command);
+
+    return requestId;
 }
 
 otai_status_t RedisChannel::wait(
         _In_ const std::string& command,
+        _In_ uint64_t requestId,
         _Out_ swss::KeyOpFieldsValuesTuple& kco)
 {
     SWSS_LOG_ENTER();
 
-    swss::Select s;
+    // in buffered mode request could still be in pipeline
 
-    s.addSelectable(m_getConsumer.get());
+    flush();
 
-    while (true)
-    {
-        SWSS_LOG_DEBUG("wait for %s response", command.c_str());
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_responseTimeoutMs);
 
-        swss::Selectable *sel;
+    return waitUntil(command, requestId, deadline, kco);
+}
 
-        int result = s.select(&sel, (int)m_responseTimeoutMs);
+otai_status_t RedisChannel::waitForResponses(
+        _In_ const std::string& command,
+        _In_ const std::vector<uint64_t>& requestIds,
+        _Out_ std::vector<swss::KeyOpFieldsValuesTuple>& kcos)
+{
+    SWSS_LOG_ENTER();
 
-        if (result == swss::Select::OBJECT)
+    kcos.clear();
+
+    flush();
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_responseTimeoutMs);
+
+    for (size_t idx = 0; idx < requestIds.size(); idx++)
+    {
+        swss::KeyOpFieldsValuesTuple kco;
+
+        auto status = waitUntil(command, requestIds[idx], deadline, kco);
+
+        if (status != OTAI_STATUS_SUCCESS && kfvKey(kco).empty())
         {
-            std::deque<swss::KeyOpFieldsValuesTuple> vkco;
+            SWSS_LOG_ERROR("failed to get %zu responses for %s, got only %zu",
+                    requestIds.size(), command.c_str(), kcos.size());
 
-            m_getConsumer->pops(vkco);
+            // abandon rest of requests, late responses will be dropped
 
-            if (vkco.empty())
-            {
-                std::string &key = kfvKey(kco);
-                std::string &op = kfvOp(kco);
-                std::vector<swss::FieldValueTuple> &fvs = kfvFieldsValues(kco);
+            std::lock_guard<std::mutex> lock(m_responseMutex);
 
-                fvs.clear();
-                key.clear();
-                op.clear();
-            }
-            else
+            for (; idx < requestIds.size(); idx++)
             {
-                kco = vkco.back();
+                m_awaitedRequests.erase(requestIds[idx]);
+                m_responses.erase(requestIds[idx]);
             }
 
-            const std::string &op = kfvOp(kco);
-            const std::string &opkey = kfvKey(kco);
+            return OTAI_STATUS_FAILURE;
+        }
 
-            SWSS_LOG_DEBUG("response: op = %s, key = %s", opkey.c_str(), op.c_str());
+        kcos.push_back(kco);
 
-            if (op != command)
-            {
-                SWSS_LOG_WARN("got not expected response: %s:%s", opkey.c_str(), op.c_str());
+        // each next response is already in flight, so extend deadline
 
-                // ignore non response messages
-                continue;
-            }
+        deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_responseTimeoutMs);
+    }
+
+    return OTAI_STATUS_SUCCESS;
+}
+
+otai_status_t RedisChannel::waitUntil(
+        _In_ const std::string& command,
+        _In_ uint64_t requestId,
+        _In_ const std::chrono::steady_clock::time_point& deadline,
+        _Out_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    kfvKey(kco).clear();
+    kfvOp(kco).clear();
+    kfvFieldsValues(kco).clear();
+
+    std::unique_lock<std::mutex> lock(m_responseMutex);
+
+    while (true)
+    {
+        auto it = m_responses.find(requestId);
+
+        if (it != m_responses.end())
+        {
+            kco = it->second;
+
+            m_responses.erase(it);
+            m_awaitedRequests.erase(requestId);
+
+            const std::string &opkey = kfvKey(kco);
 
             otai_status_t status;
             otai_deserialize_status(opkey, status);
 
-            SWSS_LOG_DEBUG("%s status: %s", command.c_str(), opkey.c_str());
+            SWSS_LOG_DEBUG("%s status: %s, request id: %" PRIu64, command.c_str(), opkey.c_str(), requestId);
 
             return status;
         }
 
-        SWSS_LOG_ERROR("SELECT operation result: %s on %s", getSelectResultAsString(result).c_str(), command.c_str());
-        break;
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            break;
+        }
+
+        if (m_responseReaderActive)
+        {
+            m_responseCv.wait_until(lock, deadline);
+
+            continue;
+        }
+
+        m_responseReaderActive = true;
+
+        lock.unlock();
+
+        try
+        {
+            readResponses(command, deadline);
+        }
+        catch (...)
+        {
+            lock.lock();
+
+            m_responseReaderActive = false;
+
+            m_responseCv.notify_all();
+
+            throw;
+        }
+
+        lock.lock();
+
+        m_responseReaderActive = false;
+
+        m_responseCv.notify_all();
     }
 
-    SWSS_LOG_ERROR("failed to get response for %s", command.c_str());
+    // response may still arrive, but it will be dropped
+
+    m_awaitedRequests.erase(requestId);
+
+    SWSS_LOG_ERROR("failed to get response for %s, request id: %" PRIu64, command.c_str(), requestId);
 
     return OTAI_STATUS_FAILURE;
 }
+
+void RedisChannel::readResponses(
+        _In_ const std::string& command,
+        _In_ const std::chrono::steady_clock::time_point& deadline)
+{
+    SWSS_LOG_ENTER();
+
+    auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+
+    if (timeout < 0)
+    {
+        timeout = 0;
+    }
+
+    swss::Select s;
+
+    s.addSelectable(m_getConsumer.get());
+
+    SWSS_LOG_DEBUG("wait for %s response", command.c_str());
+
+    swss::Selectable *sel;
+
+    int result = s.select(&sel, (int)timeout);
+
+    if (result != swss::Select::OBJECT)
+    {
+        SWSS_LOG_ERROR("SELECT operation result: %s on %s", getSelectResultAsString(result).c_str(), command.c_str());
+
+        return;
+    }
+
+    std::deque<swss::KeyOpFieldsValuesTuple> vkco;
+
+    m_getConsumer->pops(vkco);
+
+    std::lock_guard<std::mutex> lock(m_responseMutex);
+
+    for (auto& kco: vkco)
+    {
+        const std::string &op = kfvOp(kco);
+        const std::string &opkey = kfvKey(kco);
+
+        SWSS_LOG_DEBUG("response: op = %s, key = %s", op.c_str(), opkey.c_str());
+
+        if (op != command)
+        {
+            SWSS_LOG_WARN("got not expected response: %s:%s", opkey.c_str(), op.c_str());
+
+            // ignore non response messages
+            continue;
+        }
+
+        uint64_t requestId;
+
+        kfvKey(kco) = Utils::splitRequestId(opkey, requestId);
+
+        if (m_awaitedRequests.find(requestId) == m_awaitedRequests.end())
+        {
+            SWSS_LOG_WARN("dropping response %s for not awaited request id: %" PRIu64, kfvKey(kco).c_str(), requestId);
+
+            continue;
+        }
+
+        m_responses[requestId] = kco;
+    }
+}
@@ -12,6 +12,11 @@
 
 #include <memory>
 #include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <map>
+#include <unordered_set>
 
 namespace otairedis
 {
@@ -24,6 +29,17 @@ namespace otairedis
                     _In_ const std::string& dbAsic,
                     _In_ Channel::Callback callback);
 
+            /**
+             * @brief Create channel with given request and response tables.
+             *
+             * Used by tests, so they don't consume requests of running syncd.
+             */
+            RedisChannel(
+                    _In_ const std::string& dbAsic,
+                    _In_ const std::string& requestTable,
+                    _In_ const std::string& responseTable,
+                    _In_ Channel::Callback callback);
+
             virtual ~RedisChannel();
 
         public:
@@ -35,23 +51,54 @@ namespace otairedis
 
             virtual void flush() override;
 
-            virtual void set(
+            virtual uint64_t set(
                     _In_ const std::string& key, 
                     _In_ const std::vector<swss::FieldValueTuple>& values,
                     _In_ const std::string& command) override;
 
-            virtual void del(
+            virtual uint64_t del(
                     _In_ const std::string& key,
                     _In_ const std::string& command) override;
 
             virtual otai_status_t wait(
                     _In_ const std::string& command,
+                    _In_ uint64_t requestId,
                     _Out_ swss::KeyOpFieldsValuesTuple& kco) override;
 
+            virtual otai_status_t waitForResponses(
+                    _In_ const std::string& command,
+                    _In_ const std::vector<uint64_t>& requestIds,
+                    _Out_ std::vector<swss::KeyOpFieldsValuesTuple>& kcos) override;
+
         protected:
 
             virtual void notificationThreadFunction() override;
 
+        private:
+
+            /**
+             * @brief Wait for response until deadline.
+             *
+             * Only one thread at a time is reading responses from redis, all
+             * other waiting threads are woken up when reader stored response
+             * for them.
+             */
+            otai_status_t waitUntil(
+                    _In_ const std::string& command,
+                    _In_ uint64_t requestId,
+                    _In_ const std::chrono::steady_clock::time_point& deadline,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco);
+
+            /**
+             * @brief Read available responses and store them for awaited requests.
+             *
+             * Must be called only by active response reader without holding
+             * response mutex.
+             */
+            void readResponses(
+                    _In_ const std::string& command,
+                    _In_ const std::chrono::steady_clock::time_point& deadline);
+
         private:
 
             std::string m_dbAsic;
@@ -74,6 +121,31 @@ namespace otairedis
 
             std::shared_ptr<swss::RedisPipeline> m_redisPipeline;
 
+            /**
+             * @brief Mutex protecting asic state channel and request id.
+             */
+            std::mutex m_sendMutex;
+
+            uint64_t m_requestId;
+
+        private: // response tracking
+
+            std::mutex m_responseMutex;
+
+            std::condition_variable m_responseCv;
+
+            bool m_responseReaderActive;
+
+            /**
+             * @brief Requests which were sent and not yet answered or abandoned.
+             */
+            std::unordered_set<uint64_t> m_awaitedRequests;
+
+            /**
+             * @brief Responses received but not yet picked up by waiting thread.
+             */
+            std::map<uint64_t, swss::KeyOpFieldsValuesTuple> m_responses;
+
         private: // notification
 
             /**
@@ -28,13 +28,29 @@ std::vector<swss::FieldValueTuple> serialize_alarm_id_list(
         _In_ const otai_alarm_type_t *alarm_id_list);
 
 RedisRemoteOtaiInterface::RedisRemoteOtaiInterface(
-        _In_ std::function<otai_linecard_notifications_t(std::shared_ptr<Notification>)> notificationCallback):
+        _In_ std::shared_ptr<ContextConfig> contextConfig,
+        _In_ std::function<std::vector<otai_linecard_notifications_t>(const std::vector<std::shared_ptr<Notification>>&)> notificationCallback):
+    m_contextConfig(contextConfig),
     m_notificationCallback(notificationCallback)
 {
     SWSS_LOG_ENTER();
 
     m_initialized = false;
 
+    m_usePipeline = false;
+
+    m_pipelineFlushTimeoutMs = OTAI_REDIS_DEFAULT_PIPELINE_FLUSH_TIMEOUT;
+
+    m_pipelineStatus = OTAI_STATUS_SUCCESS;
+
+    m_pipelineErrorNotify = nullptr;
+
+    m_runPipelineFlushThread = false;
+
+    m_attributeCache = std::make_shared<AttributeCache>();
+
+    m_coalescedNotifications = 0;
+
     initialize(0, nullptr);
 }
 
@@ -61,12 +77,22 @@ otai_status_t RedisRemoteOtaiInterface::initialize(
         return OTAI_STATUS_FAILURE;
     }
 
+    SWSS_LOG_NOTICE("context %s using %s",
+            m_contextConfig->m_name.c_str(),
+            m_contextConfig->m_dbAsic.c_str());
+
+    // each context has its own channel, request id and VID index space
+
     m_communicationChannel = std::make_shared<RedisChannel>(
-            "ASIC_DB",
-            std::bind(&RedisRemoteOtaiInterface::handleNotification, this, _1, _2, _3));
-    m_communicationChannel->setBuffered(false);
+            m_contextConfig->m_dbAsic,
+            std::bind(&RedisRemoteOtaiInterface::handleNotifications, this, _1));
+    m_communicationChannel->setBuffered(m_usePipeline);
 
-    m_db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    m_lastPipelineFlush = std::chrono::steady_clock::now();
+
+    startPipelineFlushThread();
+
+    m_db = std::make_shared<swss::DBConnector>(m_contextConfig->m_dbAsic, 0);
 
     m_redisVidIndexGenerator = std::make_shared<RedisVidIndexGenerator>(m_db, REDIS_KEY_VIDCOUNTER);
 
@@ -92,6 +118,10 @@ otai_status_t RedisRemoteOtaiInterface::uninitialize(void)
         return OTAI_STATUS_FAILURE;
     }
 
+    stopPipelineFlushThread();
+
+    flushPendingResponses();
+
     m_communicationChannel = nullptr; // will stop thread
 
     // clear local state after stopping threads
@@ -123,9 +153,22 @@ otai_status_t RedisRemoteOtaiInterface::create(
 
     if (objectType == OTAI_OBJECT_TYPE_LINECARD)
     {
-        // for given hardware info we always return same linecard id,
-        // this is required since we could be performing warm boot here
-        linecardId = m_virtualObjectIdManager->allocateNewLinecardObjectId();
+        // linecard takes first index from context config which is not
+        // already created, so same create order always gives same linecard
+        // ids, this is required since we could be performing warm boot here
+
+        uint32_t linecardIndex = 0;
+
+        if (!getFreeLinecardIndex(linecardIndex))
+        {
+            SWSS_LOG_ERROR("all %zu linecards of context %s are already created",
+                    m_contextConfig->m_linecards.size(),
+                    m_contextConfig->m_name.c_str());
+
+            return OTAI_STATUS_INSUFFICIENT_RESOURCES;
+        }
+
+        linecardId = m_virtualObjectIdManager->allocateNewLinecardObjectId(linecardIndex);
 
         *objectId = linecardId;
 
@@ -168,18 +211,45 @@ otai_status_t RedisRemoteOtaiInterface::create(
          * TODO: should be moved inside to redis_generic_create
          */
 
-        m_linecard = std::make_shared<Linecard>(*objectId, attr_count, attr_list);
+        m_linecards[*objectId] = std::make_shared<Linecard>(*objectId, attr_count, attr_list);
     }
 
     return status;
 }
 
+bool RedisRemoteOtaiInterface::getFreeLinecardIndex(
+        _Out_ uint32_t& linecardIndex) const
+{
+    SWSS_LOG_ENTER();
+
+    std::set<uint32_t> used;
+
+    for (auto& kvp: m_linecards)
+    {
+        used.insert(VirtualObjectIdManager::getLinecardIndex(kvp.first));
+    }
+
+    for (auto& kvp: m_contextConfig->m_linecards)
+    {
+        if (used.find(kvp.first) == used.end())
+        {
+            linecardIndex = kvp.first;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
 otai_status_t RedisRemoteOtaiInterface::remove(
         _In_ otai_object_type_t objectType,
         _In_ otai_object_id_t objectId)
 {
     SWSS_LOG_ENTER();
 
+    m_attributeCache->invalidate(objectId);
+
     auto status = remove(
             objectType,
             otai_serialize_object_id(objectId));
@@ -187,7 +257,7 @@ otai_status_t RedisRemoteOtaiInterface::remove(
     if (objectType == OTAI_OBJECT_TYPE_LINECARD && status == OTAI_STATUS_SUCCESS)
     {
         SWSS_LOG_NOTICE("removing linecard id %s", otai_serialize_object_id(objectId).c_str());
-        m_linecard =  nullptr;
+        m_linecards.erase(objectId);
     }
 
     return status;
@@ -215,11 +285,85 @@ otai_status_t RedisRemoteOtaiInterface::setRedisExtensionAttribute(
     switch (attr->id)
     {
         case OTAI_REDIS_LINECARD_ATTR_FLUSH:
+            {
+                m_communicationChannel->flush();
+
+                std::lock_guard<std::recursive_mutex> lock(m_pipelineMutex);
+
+                flushPendingResponses();
+
+                auto status = m_pipelineStatus;
+
+                m_pipelineStatus = OTAI_STATUS_SUCCESS;
+
+                return status;
+            }
+
+        case OTAI_REDIS_LINECARD_ATTR_USE_PIPELINE:
+
+            if (m_usePipeline && !attr->value.booldata)
+            {
+                // pending responses must be collected before going back to
+                // synchronous mode
+
+                flushPendingResponses();
+            }
+
+            SWSS_LOG_NOTICE("setting use pipeline to %s", (attr->value.booldata ? "true" : "false"));
+
+            m_usePipeline = attr->value.booldata;
+
+            m_communicationChannel->setBuffered(m_usePipeline);
+
+            return OTAI_STATUS_SUCCESS;
+
+        case OTAI_REDIS_LINECARD_ATTR_PIPELINE_FLUSH_TIMEOUT:
+            {
+                std::lock_guard<std::recursive_mutex> lock(m_pipelineMutex);
+
+                m_pipelineFlushTimeoutMs = attr->value.u32;
+
+                m_pipelineCv.notify_all();
+            }
+
+            return OTAI_STATUS_SUCCESS;
+
+        case OTAI_REDIS_LINECARD_ATTR_PIPELINE_ERROR_NOTIFY:
+
+            m_pipelineErrorNotify = (otai_redis_pipeline_error_notification_fn)attr->value.ptr;
+
+            return OTAI_STATUS_SUCCESS;
+
+        case OTAI_REDIS_LINECARD_ATTR_USE_ATTRIBUTE_CACHE:
+
+            SWSS_LOG_NOTICE("setting use attribute cache to %s", (attr->value.booldata ? "true" : "false"));
+
+            m_attributeCache->setEnabled(attr->value.booldata);
+
+            return OTAI_STATUS_SUCCESS;
+
+        case OTAI_REDIS_LINECARD_ATTR_ATTRIBUTE_CACHE_TTL:
+
+            m_attributeCache->setTtl(attr->value.u32);
+
+            return OTAI_STATUS_SUCCESS;
+
+        case OTAI_REDIS_LINECARD_ATTR_NOTIFICATION_COALESCE_LIST:
+            {
+                std::lock_guard<std::mutex> lock(m_notificationMutex);
+
+                m_coalescedNotificationTypes.clear();
 
-            m_communicationChannel->flush();
+                for (uint32_t idx = 0; idx < attr->value.s32list.count; idx++)
+                {
+                    m_coalescedNotificationTypes.insert((otai_linecard_notification_type_t)attr->value.s32list.list[idx]);
+                }
+
+                SWSS_LOG_NOTICE("coalescing %zu notification types", m_coalescedNotificationTypes.size());
+            }
 
             return OTAI_STATUS_SUCCESS;
-            
+
         default:
             break;
     }
@@ -229,6 +373,63 @@ otai_status_t RedisRemoteOtaiInterface::setRedisExtensionAttribute(
     return OTAI_STATUS_FAILURE;
 }
 
+otai_status_t RedisRemoteOtaiInterface::getRedisExtensionAttributes(
+        _In_ otai_object_type_t objectType,
+        _In_ otai_object_id_t objectId,
+        _In_ uint32_t attr_count,
+        _Inout_ otai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    for (uint32_t idx = 0; idx < attr_count; idx++)
+    {
+        auto& attr = attr_list[idx];
+
+        switch (attr.id)
+        {
+            case OTAI_REDIS_LINECARD_ATTR_CONTEXT:
+                attr.value.u32 = m_contextConfig->m_guid;
+                break;
+
+            case OTAI_REDIS_LINECARD_ATTR_USE_PIPELINE:
+                attr.value.booldata = m_usePipeline;
+                break;
+
+            case OTAI_REDIS_LINECARD_ATTR_PIPELINE_FLUSH_TIMEOUT:
+                attr.value.u32 = m_pipelineFlushTimeoutMs;
+                break;
+
+            case OTAI_REDIS_LINECARD_ATTR_USE_ATTRIBUTE_CACHE:
+                attr.value.booldata = m_attributeCache->isEnabled();
+                break;
+
+            case OTAI_REDIS_LINECARD_ATTR_ATTRIBUTE_CACHE_HITS:
+                attr.value.u64 = m_attributeCache->getHits();
+                break;
+
+            case OTAI_REDIS_LINECARD_ATTR_ATTRIBUTE_CACHE_MISSES:
+                attr.value.u64 = m_attributeCache->getMisses();
+                break;
+
+            case OTAI_REDIS_LINECARD_ATTR_NOTIFICATION_BACKLOG:
+                attr.value.u64 = m_communicationChannel->getNotificationBacklog();
+                break;
+
+            case OTAI_REDIS_LINECARD_ATTR_NOTIFICATION_COALESCED:
+                attr.value.u64 = m_coalescedNotifications;
+                break;
+
+            default:
+
+                SWSS_LOG_ERROR("redis extension attribute %d is not readable", attr.id);
+
+                return OTAI_STATUS_FAILURE;
+        }
+    }
+
+    return OTAI_STATUS_SUCCESS;
+}
+
 otai_status_t RedisRemoteOtaiInterface::set(
         _In_ otai_object_type_t objectType,
         _In_ otai_object_id_t objectId,
@@ -241,6 +442,8 @@ otai_status_t RedisRemoteOtaiInterface::set(
         return setRedisExtensionAttribute(objectType, objectId, attr);
     }
 
+    m_attributeCache->invalidate(objectId, attr->id);
+
     auto status = set(
             objectType,
             otai_serialize_object_id(objectId),
@@ -252,9 +455,11 @@ otai_status_t RedisRemoteOtaiInterface::set(
          * When doing SET operation user may want to update notification
          * pointers.
          */
-        if (m_linecard) 
+        auto it = m_linecards.find(objectId);
+
+        if (it != m_linecards.end())
         {
-            m_linecard->updateNotifications(1, attr);
+            it->second->updateNotifications(1, attr);
         }
     }
 
@@ -269,11 +474,28 @@ otai_status_t RedisRemoteOtaiInterface::get(
 {
     SWSS_LOG_ENTER();
 
-    return get(
+    if (attr_count && RedisRemoteOtaiInterface::isRedisAttribute(objectType, attr_list))
+    {
+        return getRedisExtensionAttributes(objectType, objectId, attr_count, attr_list);
+    }
+
+    if (m_attributeCache->get(objectType, objectId, attr_count, attr_list))
+    {
+        return OTAI_STATUS_SUCCESS;
+    }
+
+    auto status = get(
             objectType,
             otai_serialize_object_id(objectId),
             attr_count,
             attr_list);
+
+    if (status == OTAI_STATUS_SUCCESS)
+    {
+        m_attributeCache->insert(objectType, objectId, attr_count, attr_list);
+    }
+
+    return status;
 }
 
 otai_status_t RedisRemoteOtaiInterface::create(
@@ -305,9 +527,17 @@ otai_status_t RedisRemoteOtaiInterface::create(
 
     SWSS_LOG_NOTICE("generic create key: %s, fields: %zu", key.c_str(), entry.size());
 
-    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_CREATE);
+    auto requestId = m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_CREATE);
+
+    // linecard create is always synchronous, since syncd needs to create
+    // linecard before any other object can be processed
 
-    auto status = waitForResponse(OTAI_COMMON_API_CREATE);
+    if (m_usePipeline && object_type != OTAI_OBJECT_TYPE_LINECARD)
+    {
+        return deferResponse(OTAI_COMMON_API_CREATE, key, requestId);
+    }
+
+    auto status = waitForResponse(OTAI_COMMON_API_CREATE, requestId);
     SWSS_LOG_NOTICE("generic create key end: %s, fields: %zu", key.c_str(), entry.size());
 
     return status;
@@ -325,9 +555,9 @@ otai_status_t RedisRemoteOtaiInterface::remove(
 
     SWSS_LOG_NOTICE("generic remove key: %s", key.c_str());
 
-    m_communicationChannel->del(key, REDIS_ASIC_STATE_COMMAND_REMOVE);
+    auto requestId = m_communicationChannel->del(key, REDIS_ASIC_STATE_COMMAND_REMOVE);
 
-    auto status = waitForResponse(OTAI_COMMON_API_REMOVE);
+    auto status = waitForResponse(OTAI_COMMON_API_REMOVE, requestId);
 
     return status;
 }
@@ -351,29 +581,214 @@ otai_status_t RedisRemoteOtaiInterface::set(
 
     SWSS_LOG_DEBUG("generic set key: %s, fields: %zu", key.c_str(), entry.size());
 
-    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_SET);
+    auto requestId = m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_SET);
+
+    if (m_usePipeline)
+    {
+        return deferResponse(OTAI_COMMON_API_SET, key, requestId);
+    }
 
-    auto status = waitForResponse(OTAI_COMMON_API_SET);
+    auto status = waitForResponse(OTAI_COMMON_API_SET, requestId);
 
     return status;
 }
 
 otai_status_t RedisRemoteOtaiInterface::waitForResponse(
-        _In_ otai_common_api_t api)
+        _In_ otai_common_api_t api,
+        _In_ uint64_t requestId)
 {
     SWSS_LOG_ENTER();
 
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, requestId, kco);
 
     return status;
 
 }
 
+otai_status_t RedisRemoteOtaiInterface::deferResponse(
+        _In_ otai_common_api_t api,
+        _In_ const std::string& key,
+        _In_ uint64_t requestId)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::recursive_mutex> lock(m_pipelineMutex);
+
+    PendingResponse pending;
+
+    pending.m_api = api;
+    pending.m_key = key;
+    pending.m_requestId = requestId;
+
+    m_pendingResponses.push_back(pending);
+
+    if (m_pendingResponses.size() >= OTAI_REDIS_DEFAULT_PIPELINE_MAX_PENDING_RESPONSES)
+    {
+        SWSS_LOG_INFO("pending responses limit %zu reached", m_pendingResponses.size());
+
+        flushPendingResponses();
+
+        return OTAI_STATUS_SUCCESS;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+
+    m_lastDeferredResponse = now;
+
+    if (m_pendingResponses.size() == 1)
+    {
+        // pipeline flush thread waits only when there is nothing pending
+
+        m_pipelineCv.notify_all();
+    }
+
+    if (now - m_lastPipelineFlush >= std::chrono::milliseconds(m_pipelineFlushTimeoutMs))
+    {
+        m_communicationChannel->flush();
+
+        m_lastPipelineFlush = now;
+    }
+
+    return OTAI_STATUS_SUCCESS;
+}
+
+void RedisRemoteOtaiInterface::flushPendingResponses()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::recursive_mutex> lock(m_pipelineMutex);
+
+    if (m_pendingResponses.empty())
+    {
+        return;
+    }
+
+    m_lastPipelineFlush = std::chrono::steady_clock::now();
+
+    std::vector<uint64_t> requestIds;
+
+    for (auto& pending: m_pendingResponses)
+    {
+        requestIds.push_back(pending.m_requestId);
+    }
+
+    std::vector<swss::KeyOpFieldsValuesTuple> kcos;
+
+    auto status = m_communicationChannel->waitForResponses(
+            REDIS_ASIC_STATE_COMMAND_GETRESPONSE,
+            requestIds,
+            kcos);
+
+    if (status != OTAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("failed to get all %zu pending responses, got %zu, treating rest as failed",
+                m_pendingResponses.size(),
+                kcos.size());
+    }
+
+    size_t failed = 0;
+
+    for (size_t idx = 0; idx < m_pendingResponses.size(); idx++)
+    {
+        auto& pending = m_pendingResponses[idx];
+
+        otai_status_t opStatus = OTAI_STATUS_FAILURE;
+
+        if (idx < kcos.size())
+        {
+            otai_deserialize_status(kfvKey(kcos[idx]), opStatus);
+        }
+
+        if (opStatus == OTAI_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        failed++;
+
+        SWSS_LOG_ERROR("pipelined %s %s failed: %s",
+                (pending.m_api == OTAI_COMMON_API_CREATE ? "create" : "set"),
+                pending.m_key.c_str(),
+                otai_serialize_status(opStatus).c_str());
+
+        if (m_pipelineStatus == OTAI_STATUS_SUCCESS)
+        {
+            m_pipelineStatus = opStatus;
+        }
+
+        if (m_pipelineErrorNotify)
+        {
+            m_pipelineErrorNotify(pending.m_api, pending.m_key.c_str(), opStatus);
+        }
+    }
+
+    SWSS_LOG_INFO("collected %zu pending responses, %zu failed", m_pendingResponses.size(), failed);
+
+    m_pendingResponses.clear();
+}
+
+void RedisRemoteOtaiInterface::pipelineFlushThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::recursive_mutex> lock(m_pipelineMutex);
+
+    while (m_runPipelineFlushThread)
+    {
+        if (m_pendingResponses.empty())
+        {
+            m_pipelineCv.wait(lock);
+
+            continue;
+        }
+
+        auto deadline = m_lastDeferredResponse + std::chrono::milliseconds(m_pipelineFlushTimeoutMs);
+
+        if (std::chrono::steady_clock::now() < deadline)
+        {
+            m_pipelineCv.wait_until(lock, deadline);
+
+            continue;
+        }
+
+        SWSS_LOG_INFO("pipeline idle, collecting %zu pending responses", m_pendingResponses.size());
+
+        flushPendingResponses();
+    }
+}
+
+void RedisRemoteOtaiInterface::startPipelineFlushThread()
+{
+    SWSS_LOG_ENTER();
+
+    m_runPipelineFlushThread = true;
+
+    m_pipelineFlushThread = std::make_shared<std::thread>(&RedisRemoteOtaiInterface::pipelineFlushThreadFunction, this);
+}
+
+void RedisRemoteOtaiInterface::stopPipelineFlushThread()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_pipelineMutex);
+
+        m_runPipelineFlushThread = false;
+
+        m_pipelineCv.notify_all();
+    }
+
+    m_pipelineFlushThread->join();
+
+    m_pipelineFlushThread = nullptr;
+}
+
 otai_status_t RedisRemoteOtaiInterface::waitForGetResponse(
         _In_ otai_object_type_t objectType,
+        _In_ uint64_t requestId,
         _In_ uint32_t attr_count,
         _Inout_ otai_attribute_t *attr_list)
 {
@@ -381,7 +796,7 @@ otai_status_t RedisRemoteOtaiInterface::waitForGetResponse(
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, requestId, kco);
 
     auto &values = kfvFieldsValues(kco);
 
@@ -438,9 +853,9 @@ otai_status_t RedisRemoteOtaiInterface::get(
 
     // get is special, it will not put data
     // into asic view, only to message queue
-    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_GET);
+    auto requestId = m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_GET);
 
-    auto status = waitForGetResponse(objectType, attr_count, attr_list);
+    auto status = waitForGetResponse(objectType, requestId, attr_count, attr_list);
 
     return status;
 }
@@ -467,13 +882,14 @@ otai_status_t RedisRemoteOtaiInterface::getStats(
 
     // get_stats will not put data to asic view, only to message queue
 
-    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_GET_STATS);
+    auto requestId = m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_GET_STATS);
 
-    return waitForGetStatsResponse(object_type, number_of_counters, counter_ids, counters);
+    return waitForGetStatsResponse(object_type, requestId, number_of_counters, counter_ids, counters);
 }
 
 otai_status_t RedisRemoteOtaiInterface::waitForGetStatsResponse(
         _In_ otai_object_type_t object_type,
+        _In_ uint64_t requestId,
         _In_ uint32_t number_of_counters,
         _In_ const otai_stat_id_t *counter_ids,
         _Out_ otai_stat_value_t *counters)
@@ -482,7 +898,7 @@ otai_status_t RedisRemoteOtaiInterface::waitForGetStatsResponse(
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, requestId, kco);
 
     if (status == OTAI_STATUS_SUCCESS)
     {
@@ -543,20 +959,21 @@ otai_status_t RedisRemoteOtaiInterface::clearStats(
     SWSS_LOG_DEBUG("generic clear stats key: %s, fields: %zu", key.c_str(), values.size());
 
     // clear_stats will not put data into asic view, only to message queue
-    m_communicationChannel->set(key, values, REDIS_ASIC_STATE_COMMAND_CLEAR_STATS);
+    auto requestId = m_communicationChannel->set(key, values, REDIS_ASIC_STATE_COMMAND_CLEAR_STATS);
 
-    auto status = waitForClearStatsResponse();
+    auto status = waitForClearStatsResponse(requestId);
 
     return status;
 }
 
-otai_status_t RedisRemoteOtaiInterface::waitForClearStatsResponse()
+otai_status_t RedisRemoteOtaiInterface::waitForClearStatsResponse(
+        _In_ uint64_t requestId)
 {
     SWSS_LOG_ENTER();
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, requestId, kco);
 
     return status;
 }
@@ -575,10 +992,8 @@ bool RedisRemoteOtaiInterface::isRedisAttribute(
     return true;
 }
 
-void RedisRemoteOtaiInterface::handleNotification(
-        _In_ const std::string &name,
-        _In_ const std::string &serializedNotification,
-        _In_ const std::vector<swss::FieldValueTuple> &values)
+void RedisRemoteOtaiInterface::handleNotifications(
+        _In_ const std::vector<swss::KeyOpFieldsValuesTuple>& batch)
 {
     SWSS_LOG_ENTER();
 
@@ -596,16 +1011,92 @@ void RedisRemoteOtaiInterface::handleNotification(
     //
     // But before that we will extract linecard id from notification itself.
 
-    auto notification = NotificationFactory::deserialize(name, serializedNotification);
+    std::vector<std::shared_ptr<Notification>> notifications;
+
+    for (auto& kco: batch)
+    {
+        auto& name = kfvOp(kco);
+        auto& serializedNotification = kfvKey(kco);
+
+        SWSS_LOG_DEBUG("notification: op = %s, data = %s", name.c_str(), serializedNotification.c_str());
+
+        auto notification = NotificationFactory::deserialize(name, serializedNotification);
+
+        if (notification)
+        {
+            notifications.push_back(notification);
+        }
+    }
+
+    notifications = coalesceNotifications(notifications);
+
+    if (notifications.empty())
+    {
+        return;
+    }
+
+    auto sns = m_notificationCallback(notifications); // will be synchronized to api mutex
+
+    // execute callbacks from notification thread
+
+    for (size_t idx = 0; idx < notifications.size(); idx++)
+    {
+        notifications[idx]->executeCallback(sns.at(idx));
+    }
+}
+
+std::vector<std::shared_ptr<Notification>> RedisRemoteOtaiInterface::coalesceNotifications(
+        _In_ const std::vector<std::shared_ptr<Notification>>& notifications)
+{
+    SWSS_LOG_ENTER();
+
+    std::set<otai_linecard_notification_type_t> types;
+
+    {
+        std::lock_guard<std::mutex> lock(m_notificationMutex);
+
+        types = m_coalescedNotificationTypes;
+    }
+
+    if (types.empty() || notifications.size() < 2)
+    {
+        return notifications;
+    }
+
+    // find last notification index for each coalesced type and object
+
+    std::map<std::pair<otai_linecard_notification_type_t, otai_object_id_t>, size_t> last;
+
+    for (size_t idx = 0; idx < notifications.size(); idx++)
+    {
+        auto type = notifications[idx]->getNotificationType();
+
+        if (types.find(type) != types.end())
+        {
+            last[std::make_pair(type, notifications[idx]->getAnyObjectId())] = idx;
+        }
+    }
+
+    std::vector<std::shared_ptr<Notification>> result;
 
-    if (notification)
+    for (size_t idx = 0; idx < notifications.size(); idx++)
     {
-        auto sn = m_notificationCallback(notification); // will be synchronized to api mutex
+        auto type = notifications[idx]->getNotificationType();
 
-        // execute callback from notification thread
+        if (types.find(type) != types.end() &&
+                last.at(std::make_pair(type, notifications[idx]->getAnyObjectId())) != idx)
+        {
+            m_coalescedNotifications++;
 
-        notification->executeCallback(sn);
+            continue;
+        }
+
+        result.push_back(notifications[idx]);
     }
+
+    SWSS_LOG_DEBUG("coalesced %zu notifications into %zu", notifications.size(), result.size());
+
+    return result;
 }
 
 otai_object_type_t RedisRemoteOtaiInterface::objectTypeQuery(
@@ -641,7 +1132,9 @@ void RedisRemoteOtaiInterface::clear_local_state()
 
     // Will need to be executed after init VIEW
 
-    m_linecard = nullptr;
+    m_linecards.clear();
+
+    m_attributeCache->clear();
 
     m_virtualObjectIdManager = 
         std::make_shared<VirtualObjectIdManager>(
@@ -680,11 +1173,24 @@ otai_linecard_notifications_t RedisRemoteOtaiInterface::syncProcessNotification(
 
     auto objectId = notification->getAnyObjectId();
 
+    // notification may indicate that cached values are no longer valid
+
+    if (notification->getNotificationType() == OTAI_LINECARD_NOTIFICATION_TYPE_LINECARD_STATE_CHANGE)
+    {
+        m_attributeCache->clear();
+    }
+    else
+    {
+        m_attributeCache->invalidate(objectId);
+    }
+
     auto linecardId = m_virtualObjectIdManager->otaiLinecardIdQuery(objectId);
 
-    if (m_linecard)
+    auto it = m_linecards.find(linecardId);
+
+    if (it != m_linecards.end())
     {
-        return m_linecard->getLinecardNotifications(); // explicit copy
+        return it->second->getLinecardNotifications(); // explicit copy
     }
 
     SWSS_LOG_WARN("linecard %s not present in container, returning empty linecard notifications",
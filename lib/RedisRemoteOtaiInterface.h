@@ -4,6 +4,9 @@
 #include "VirtualObjectIdManager.h"
 #include "RedisVidIndexGenerator.h"
 #include "RedisChannel.h"
+#include "AttributeCache.h"
+#include "ContextConfig.h"
+#include "otairedis.h"
 
 #include "meta/Notification.h"
 #include "meta/OtaiInterface.h"
@@ -16,6 +19,13 @@
 #include <memory>
 #include <functional>
 #include <map>
+#include <deque>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
 
 namespace otairedis
 {
@@ -25,7 +35,8 @@ namespace otairedis
         public:
 
             RedisRemoteOtaiInterface(
-                    _In_ std::function<otai_linecard_notifications_t(std::shared_ptr<Notification>)> notificationCallback);
+                    _In_ std::shared_ptr<ContextConfig> contextConfig,
+                    _In_ std::function<std::vector<otai_linecard_notifications_t>(const std::vector<std::shared_ptr<Notification>>&)> notificationCallback);
 
             virtual ~RedisRemoteOtaiInterface();
 
@@ -102,7 +113,8 @@ namespace otairedis
             /**
              * @brief Checks whether attribute is custom OTAI_REDIS_SWITCH attribute.
              *
-             * This function should only be used on linecard_api set function.
+             * This function should only be used on linecard_api set and get
+             * functions.
              */
             static bool isRedisAttribute(
                     _In_ otai_object_id_t obejctType,
@@ -147,7 +159,43 @@ namespace otairedis
              * otai_status_t.
              */
             otai_status_t waitForResponse(
-                    _In_ otai_common_api_t api);
+                    _In_ otai_common_api_t api,
+                    _In_ uint64_t requestId);
+
+        private: // pipeline
+
+            /**
+             * @brief Defer response for create/set in pipeline mode.
+             *
+             * Operation is remembered as pending, pipeline is flushed when
+             * flush timeout elapsed, and all pending responses are collected
+             * when their number reaches the limit.
+             */
+            otai_status_t deferResponse(
+                    _In_ otai_common_api_t api,
+                    _In_ const std::string& key,
+                    _In_ uint64_t requestId);
+
+            /**
+             * @brief Flush pipeline and collect all pending responses.
+             *
+             * Failed operations are reported by pipeline error notification
+             * and first failure is remembered until FLUSH attribute is set.
+             */
+            void flushPendingResponses();
+
+            /**
+             * @brief Collect pending responses when pipeline is idle.
+             *
+             * Without this, responses of last operations before caller goes
+             * idle would be collected only on next create/set or FLUSH, and
+             * their failures would not be reported.
+             */
+            void pipelineFlushThreadFunction();
+
+            void startPipelineFlushThread();
+
+            void stopPipelineFlushThread();
 
             /**
              * @brief Wait for GET response.
@@ -161,6 +209,7 @@ namespace otairedis
              */
             otai_status_t waitForGetResponse(
                     _In_ otai_object_type_t objectType,
+                    _In_ uint64_t requestId,
                     _In_ uint32_t attr_count,
                     _Inout_ otai_attribute_t *attr_list);
 
@@ -168,34 +217,63 @@ namespace otairedis
 
             otai_status_t waitForGetStatsResponse(
                     _In_ otai_object_type_t object_type,
+                    _In_ uint64_t requestId,
                     _In_ uint32_t number_of_counters,
                     _In_ const otai_stat_id_t *counter_ids,
                     _Out_ otai_stat_value_t *counters);
 
-            otai_status_t waitForClearStatsResponse();
+            otai_status_t waitForClearStatsResponse(
+                    _In_ uint64_t requestId);
 
         private: // notification
-            void handleNotification(
-                    _In_ const std::string &name,
-                    _In_ const std::string &serializedNotification,
-                    _In_ const std::vector<swss::FieldValueTuple> &values);
+            void handleNotifications(
+                    _In_ const std::vector<swss::KeyOpFieldsValuesTuple>& batch);
+
+            /**
+             * @brief Coalesce notifications.
+             *
+             * For notification types with coalescing enabled, only last
+             * notification for given object in batch is kept, this is useful
+             * for state like notifications, where only latest state matters.
+             */
+            std::vector<std::shared_ptr<Notification>> coalesceNotifications(
+                    _In_ const std::vector<std::shared_ptr<Notification>>& notifications);
 
             otai_status_t setRedisExtensionAttribute(
                     _In_ otai_object_type_t objectType,
                     _In_ otai_object_id_t objectId,
                     _In_ const otai_attribute_t *attr);
 
+            otai_status_t getRedisExtensionAttributes(
+                    _In_ otai_object_type_t objectType,
+                    _In_ otai_object_id_t objectId,
+                    _In_ uint32_t attr_count,
+                    _Inout_ otai_attribute_t *attr_list);
+
         private:
             void clear_local_state();
 
+            /**
+             * @brief Get first linecard index from context config which is
+             * not yet created.
+             */
+            bool getFreeLinecardIndex(
+                    _Out_ uint32_t& linecardIndex) const;
+
             std::string getHardwareInfo(
                     _In_ uint32_t attrCount,
                     _In_ const otai_attribute_t *attrList) const;
 
         private:
+            std::shared_ptr<ContextConfig> m_contextConfig;
+
             bool m_initialized;
 
-            std::shared_ptr<Linecard> m_linecard;
+            /**
+             * @brief Created linecards by linecard id, modified only under
+             * exclusive API lock.
+             */
+            std::map<otai_object_id_t, std::shared_ptr<Linecard>> m_linecards;
 
             std::shared_ptr<VirtualObjectIdManager> m_virtualObjectIdManager;
 
@@ -207,7 +285,75 @@ namespace otairedis
 
             std::shared_ptr<Channel> m_communicationChannel;
 
-            std::function<otai_linecard_notifications_t(std::shared_ptr<Notification>)> m_notificationCallback;
+            std::function<std::vector<otai_linecard_notifications_t>(const std::vector<std::shared_ptr<Notification>>&)> m_notificationCallback;
+
+        private: // pipeline
+
+            typedef struct _PendingResponse
+            {
+                otai_common_api_t m_api;
+
+                std::string m_key;
+
+                uint64_t m_requestId;
+
+            } PendingResponse;
+
+            /**
+             * @brief Mutex protecting pipeline state.
+             *
+             * Recursive since reaching pending responses limit will collect
+             * them while deferring next response.
+             */
+            std::recursive_mutex m_pipelineMutex;
+
+            bool m_usePipeline;
+
+            uint32_t m_pipelineFlushTimeoutMs;
+
+            std::chrono::steady_clock::time_point m_lastPipelineFlush;
+
+            /**
+             * @brief Time of last deferred response.
+             *
+             * Pending responses are collected by pipeline flush thread when
+             * no operation was deferred within flush timeout.
+             */
+            std::chrono::steady_clock::time_point m_lastDeferredResponse;
+
+            std::condition_variable_any m_pipelineCv;
+
+            bool m_runPipelineFlushThread;
+
+            std::shared_ptr<std::thread> m_pipelineFlushThread;
+
+            /**
+             * @brief Operations sent in pipeline mode awaiting response.
+             */
+            std::deque<PendingResponse> m_pendingResponses;
+
+            /**
+             * @brief Status of first failed pipelined operation since last flush.
+             */
+            otai_status_t m_pipelineStatus;
+
+            otai_redis_pipeline_error_notification_fn m_pipelineErrorNotify;
+
+        private: // notifications
+
+            /**
+             * @brief Mutex protecting notification coalescing policy.
+             *
+             * Policy is set from API thread and used by notification thread.
+             */
+            std::mutex m_notificationMutex;
+
+            std::set<otai_linecard_notification_type_t> m_coalescedNotificationTypes;
+
+            std::atomic<uint64_t> m_coalescedNotifications;
+
+        private: // attribute cache
 
+            std::shared_ptr<AttributeCache> m_attributeCache;
     };
 }
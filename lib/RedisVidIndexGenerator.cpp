@@ -1,31 +1,84 @@
 #include "RedisVidIndexGenerator.h"
 
 #include "swss/logger.h"
+#include "swss/rediscommand.h"
+#include "swss/redisreply.h"
+
+#include <inttypes.h>
 
 using namespace otairedis;
 
 RedisVidIndexGenerator::RedisVidIndexGenerator(
         _In_ std::shared_ptr<swss::DBConnector> dbConnector,
-        _In_ const std::string& vidCounterName):
+        _In_ const std::string& vidCounterName,
+        _In_ uint64_t blockSize):
     m_dbConnector(dbConnector),
-    m_vidCounterName(vidCounterName)
+    m_vidCounterName(vidCounterName),
+    m_blockSize(blockSize),
+    m_nextIndex(1),
+    m_lastIndex(0)
 {
     SWSS_LOG_ENTER();
+
+    if (m_blockSize == 0)
+    {
+        SWSS_LOG_THROW("block size must be greater than zero");
+    }
 }
 
 uint64_t RedisVidIndexGenerator::increment()
 {
     SWSS_LOG_ENTER();
 
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_nextIndex > m_lastIndex)
+    {
+        reserveBlock();
+    }
+
+    return m_nextIndex++;
+}
+
+void RedisVidIndexGenerator::reserveBlock()
+{
+    SWSS_LOG_ENTER();
+
     // this counter must be atomic since it can be independently accessed by
-    // otairedis and syncd
+    // otairedis and syncd, INCRBY guarantees that ranges reserved by
+    // different processes will never overlap
 
-    return m_dbConnector->incr(m_vidCounterName); // "VIDCOUNTER"
+    if (m_blockSize == 1)
+    {
+        m_lastIndex = m_dbConnector->incr(m_vidCounterName); // "VIDCOUNTER"
+        m_nextIndex = m_lastIndex;
+
+        return;
+    }
+
+    swss::RedisCommand cmd;
+
+    cmd.format("INCRBY %s %" PRIu64, m_vidCounterName.c_str(), m_blockSize);
+
+    swss::RedisReply r(m_dbConnector.get(), cmd, REDIS_REPLY_INTEGER);
+
+    m_lastIndex = (uint64_t)r.getContext()->integer;
+    m_nextIndex = m_lastIndex - m_blockSize + 1;
+
+    SWSS_LOG_INFO("reserved %s range 0x%" PRIx64 "-0x%" PRIx64,
+            m_vidCounterName.c_str(),
+            m_nextIndex,
+            m_lastIndex);
 }
 
 void RedisVidIndexGenerator::reset()
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_ERROR("not implemented");
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // remaining indexes in current range are abandoned
+
+    m_nextIndex = 1;
+    m_lastIndex = 0;
 }
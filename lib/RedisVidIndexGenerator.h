@@ -1,11 +1,13 @@
 #pragma once
 
 #include "OidIndexGenerator.h"
+#include "otairediscommon.h"
 
 #include "swss/dbconnector.h"
 #include "swss/sal.h"
 
 #include <memory>
+#include <mutex>
 
 namespace otairedis
 {
@@ -16,20 +18,55 @@ namespace otairedis
 
             RedisVidIndexGenerator(
                     _In_ std::shared_ptr<swss::DBConnector> dbConnector,
-                    _In_ const std::string& vidCounterName);
+                    _In_ const std::string& vidCounterName,
+                    _In_ uint64_t blockSize = REDIS_VID_INDEX_BLOCK_SIZE);
 
             virtual ~RedisVidIndexGenerator() = default;
 
         public:
 
+            /**
+             * @brief Get next object index.
+             *
+             * Index is taken from locally reserved range, new range is
+             * reserved from redis when current one is used up.
+             */
             virtual uint64_t increment() override;
 
+            /**
+             * @brief Drop locally reserved range.
+             *
+             * Next increment will reserve new range.
+             */
             virtual void reset() override;
 
+        private:
+
+            void reserveBlock();
+
         private:
 
             std::shared_ptr<swss::DBConnector> m_dbConnector;
 
             std::string m_vidCounterName;
+
+            uint64_t m_blockSize;
+
+            /**
+             * @brief Next index to hand out from reserved range.
+             */
+            uint64_t m_nextIndex;
+
+            /**
+             * @brief Last index of reserved range.
+             */
+            uint64_t m_lastIndex;
+
+            /**
+             * @brief Mutex protecting database connector.
+             *
+             * Objects can be created from multiple threads at the same time.
+             */
+            std::mutex m_mutex;
     };
 }
@@ -4,6 +4,8 @@ extern "C" {
 #include "otaimetadata.h"
 }
 
+#include "otairediscommon.h"
+
 #include "meta/otai_serialize.h"
 #include "swss/logger.h"
 
@@ -62,3 +64,41 @@ void Utils::clearOidValues(
 
     }
 }
+
+std::string Utils::joinRequestId(
+        _In_ const std::string& key,
+        _In_ uint64_t requestId)
+{
+    SWSS_LOG_ENTER();
+
+    return key + REDIS_REQUEST_ID_DELIMITER + std::to_string(requestId);
+}
+
+std::string Utils::splitRequestId(
+        _In_ const std::string& key,
+        _Out_ uint64_t& requestId)
+{
+    SWSS_LOG_ENTER();
+
+    requestId = 0;
+
+    auto pos = key.find_last_of(REDIS_REQUEST_ID_DELIMITER);
+
+    if (pos == std::string::npos)
+    {
+        return key;
+    }
+
+    try
+    {
+        requestId = std::stoull(key.substr(pos + 1));
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("invalid request id in key %s: %s", key.c_str(), e.what());
+
+        return key;
+    }
+
+    return key.substr(0, pos);
+}
@@ -4,6 +4,8 @@ extern "C" {
 #include "otai.h"
 }
 
+#include <string>
+
 namespace otairedis
 {
     class Utils
@@ -33,5 +35,22 @@ namespace otairedis
 
                 static void clearOidList(
                         _Out_ otai_object_list_t& list);
+
+                /**
+                 * @brief Append request id to request or response key.
+                 */
+                static std::string joinRequestId(
+                        _In_ const std::string& key,
+                        _In_ uint64_t requestId);
+
+                /**
+                 * @brief Split request id from request or response key.
+                 *
+                 * Returns key without request id. If key don't contain request
+                 * id, requestId is set to zero.
+                 */
+                static std::string splitRequestId(
+                        _In_ const std::string& key,
+                        _Out_ uint64_t& requestId);
     };
 }
@@ -194,15 +194,25 @@ otai_object_id_t VirtualObjectIdManager::allocateNewObjectId(
     return objectId;
 }
 
-otai_object_id_t VirtualObjectIdManager::allocateNewLinecardObjectId()
+otai_object_id_t VirtualObjectIdManager::allocateNewLinecardObjectId(
+        _In_ uint32_t linecardIndex)
 {
     SWSS_LOG_ENTER();
 
-    uint32_t linecardIndex = 0;
+    if (linecardIndex > OTAI_REDIS_LINECARD_INDEX_MAX)
+    {
+        SWSS_LOG_ERROR("linecard index %u is out of range, max is %llu",
+                linecardIndex,
+                OTAI_REDIS_LINECARD_INDEX_MAX);
+
+        return OTAI_NULL_OBJECT_ID;
+    }
+
     otai_object_id_t objectId = constructObjectId(OTAI_OBJECT_TYPE_LINECARD, linecardIndex, linecardIndex);
 
-    SWSS_LOG_NOTICE("created LINECARD VID %s for ",
-            otai_serialize_object_id(objectId).c_str());
+    SWSS_LOG_NOTICE("created LINECARD VID %s for linecard index %u",
+            otai_serialize_object_id(objectId).c_str(),
+            linecardIndex);
 
     return objectId;
 }
@@ -273,6 +283,14 @@ otai_object_type_t VirtualObjectIdManager::objectTypeQuery(
     return objectType;
 }
 
+uint32_t VirtualObjectIdManager::getLinecardIndex(
+        _In_ otai_object_id_t objectId)
+{
+    SWSS_LOG_ENTER();
+
+    return (uint32_t)OTAI_REDIS_GET_LINECARD_INDEX(objectId);
+}
+
 uint64_t VirtualObjectIdManager::getObjectIndex(
         _In_ otai_object_id_t objectId)
 {
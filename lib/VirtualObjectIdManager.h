@@ -66,8 +66,12 @@ namespace otairedis
 
             /**
              * @brief Allocate new linecard object id.
+             *
+             * Linecard index is taken from context configuration, so linecard
+             * VID is the same across restarts and points to its context.
              */
-            otai_object_id_t allocateNewLinecardObjectId();
+            otai_object_id_t allocateNewLinecardObjectId(
+                    _In_ uint32_t linecardIndex);
 
         private:
             /**
@@ -102,6 +106,14 @@ namespace otairedis
             static otai_object_type_t objectTypeQuery(
                     _In_ otai_object_id_t objectId);
 
+            /**
+             * @brief Get linecard index.
+             *
+             * Returns linecard index encoded in object id.
+             */
+            static uint32_t getLinecardIndex(
+                    _In_ otai_object_id_t objectId);
+
             /**
              * @brief Get object index.
              *
@@ -18,15 +18,186 @@ extern "C" {
  */
 #define OTAI_REDIS_DEFAULT_SYNC_OPERATION_RESPONSE_TIMEOUT (17*1000)
 
+/**
+ * @brief Default pipeline flush timeout in milliseconds.
+ *
+ * When pipeline mode is enabled, buffered operations are pushed to redis
+ * at the latest when this time elapsed since last flush, and pending
+ * responses are collected when no create/set was issued within this time.
+ */
+#define OTAI_REDIS_DEFAULT_PIPELINE_FLUSH_TIMEOUT (100)
+
+/**
+ * @brief Default maximum number of pending responses in pipeline mode.
+ *
+ * When this number of create/set operations is awaiting response from syncd,
+ * pipeline is flushed and all pending responses are collected.
+ */
+#define OTAI_REDIS_DEFAULT_PIPELINE_MAX_PENDING_RESPONSES (1024)
+
+/**
+ * @brief Default attribute cache TTL in milliseconds.
+ *
+ * Applies to attributes which are not create only or read only static.
+ */
+#define OTAI_REDIS_DEFAULT_ATTRIBUTE_CACHE_TTL (1000)
+
+/**
+ * @brief Pipeline error notification.
+ *
+ * Called when create/set operation executed in pipeline mode failed on syncd
+ * side. Since in pipeline mode create/set returns success before syncd
+ * processed request, this is the only place where such failure is reported.
+ *
+ * Notification is called from inside of OTAI API call or from pipeline flush
+ * thread when pipeline is idle, so it must not call OTAI API.
+ *
+ * @param[in] api Api which failed (create or set)
+ * @param[in] key Serialized object key, OBJECT_TYPE:oid
+ * @param[in] status Status returned by syncd
+ */
+typedef void (*otai_redis_pipeline_error_notification_fn)(
+        _In_ otai_common_api_t api,
+        _In_ const char *key,
+        _In_ otai_status_t status);
+
 typedef enum _otai_redis_linecard_attr_t
 {
     /**
      * @brief Will flush redis pipeline
      *
+     * When pipeline mode is enabled, will also wait for all pending responses
+     * from syncd and return failure if any of pipelined operations failed
+     * since last flush.
+     *
      * @type bool
      * @flags CREATE_AND_SET
      * @default false
      */
     OTAI_REDIS_LINECARD_ATTR_FLUSH = OTAI_LINECARD_ATTR_CUSTOM_RANGE_START,
 
+    /**
+     * @brief Use redis pipeline for create and set.
+     *
+     * When enabled, create (except linecard) and set operations are buffered
+     * and will return success without waiting for syncd response. Failures
+     * are reported by pipeline error notification and by FLUSH attribute.
+     * Other operations push buffered operations to redis and wait only for
+     * their own response. Pending responses are collected when their number
+     * reaches limit, when pipeline was idle for flush timeout, on FLUSH and
+     * when pipeline is disabled.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default false
+     */
+    OTAI_REDIS_LINECARD_ATTR_USE_PIPELINE,
+
+    /**
+     * @brief Pipeline flush timeout in milliseconds.
+     *
+     * Also time after last create/set when pending responses are collected.
+     *
+     * @type otai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default OTAI_REDIS_DEFAULT_PIPELINE_FLUSH_TIMEOUT
+     */
+    OTAI_REDIS_LINECARD_ATTR_PIPELINE_FLUSH_TIMEOUT,
+
+    /**
+     * @brief Pipeline error notification.
+     *
+     * @type otai_pointer_t otai_redis_pipeline_error_notification_fn
+     * @flags CREATE_AND_SET
+     * @default NULL
+     */
+    OTAI_REDIS_LINECARD_ATTR_PIPELINE_ERROR_NOTIFY,
+
+    /**
+     * @brief Use client side attribute cache for get.
+     *
+     * Create only and read only static attributes are cached until object
+     * is removed or linecard state changes, other attributes expire after
+     * attribute cache TTL. Set operation invalidates attribute.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default false
+     */
+    OTAI_REDIS_LINECARD_ATTR_USE_ATTRIBUTE_CACHE,
+
+    /**
+     * @brief Attribute cache TTL in milliseconds.
+     *
+     * @type otai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default OTAI_REDIS_DEFAULT_ATTRIBUTE_CACHE_TTL
+     */
+    OTAI_REDIS_LINECARD_ATTR_ATTRIBUTE_CACHE_TTL,
+
+    /**
+     * @brief Number of get operations served from attribute cache.
+     *
+     * @type otai_uint64_t
+     * @flags READ_ONLY
+     */
+    OTAI_REDIS_LINECARD_ATTR_ATTRIBUTE_CACHE_HITS,
+
+    /**
+     * @brief Number of get operations not served from attribute cache.
+     *
+     * @type otai_uint64_t
+     * @flags READ_ONLY
+     */
+    OTAI_REDIS_LINECARD_ATTR_ATTRIBUTE_CACHE_MISSES,
+
+    /**
+     * @brief Notification types to coalesce.
+     *
+     * For listed notification types, when multiple notifications for the same
+     * object are received in one batch, only the last one is delivered.
+     * Should be used only for state like notifications.
+     *
+     * @type otai_s32_list_t otai_linecard_notification_type_t
+     * @flags CREATE_AND_SET
+     * @default empty
+     */
+    OTAI_REDIS_LINECARD_ATTR_NOTIFICATION_COALESCE_LIST,
+
+    /**
+     * @brief Notification consumer queue depth.
+     *
+     * Number of notifications already received from redis and waiting
+     * behind batch which is being dispatched. Notifications are dispatched
+     * in batches of at most 256.
+     *
+     * @type otai_uint64_t
+     * @flags READ_ONLY
+     */
+    OTAI_REDIS_LINECARD_ATTR_NOTIFICATION_BACKLOG,
+
+    /**
+     * @brief Number of notifications dropped by coalescing.
+     *
+     * @type otai_uint64_t
+     * @flags READ_ONLY
+     */
+    OTAI_REDIS_LINECARD_ATTR_NOTIFICATION_COALESCED,
+
+    /**
+     * @brief Context global id.
+     *
+     * Selects context from context config in which linecard will be
+     * created. It can be passed at any position of linecard create
+     * attributes, at most once, it is consumed by client and not passed to
+     * syncd. After
+     * create, all API calls are routed to context by linecard index
+     * encoded in object id.
+     *
+     * @type otai_uint32_t
+     * @flags CREATE_ONLY
+     * @default 0
+     */
+    OTAI_REDIS_LINECARD_ATTR_CONTEXT,
+
 } otai_redis_linecard_attr_t;
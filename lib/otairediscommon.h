@@ -28,6 +28,14 @@
 
 #define REDIS_ASIC_STATE_COMMAND_GETRESPONSE        "getresponse"
 
+/*
+ * Request id is appended to the key of each request sent by otairedis and
+ * syncd is appending it back to response status, this way multiple requests
+ * can be in flight and each response is matched to its request.
+ */
+
+#define REDIS_REQUEST_ID_DELIMITER  '@'
+
 // TODO move this to OTAI meta repository for auto generate
 
 #define OTAI_APS_NOTIFICATION_NAME_OLP_SWITCH_NOTIFY                 "olp_switch_notify"
@@ -49,6 +57,15 @@
  */
 #define REDIS_KEY_VIDCOUNTER "VIDCOUNTER"
 
+/**
+ * @brief Default number of object indexes reserved at once from VIDCOUNTER.
+ *
+ * Each process reserves range of indexes with single INCRBY and then hands
+ * them out locally. Unused indexes from reserved range are never reused,
+ * which is fine since object index space is 48 bits.
+ */
+#define REDIS_VID_INDEX_BLOCK_SIZE  (256)
+
 /**
  * @brief Table which will be used to forward notifications from syncd.
  */
@@ -64,4 +81,6 @@
 #define REDIS_DEFAULT_DATABASE_ASIC         "ASIC_DB"
 #define REDIS_DEFAULT_DATABASE_STATE        "STATE_DB"
 #define REDIS_DEFAULT_DATABASE_COUNTERS     "COUNTERS_DB"
+#define REDIS_DEFAULT_DATABASE_FLEX_COUNTER "FLEX_COUNTER_DB"
+#define REDIS_DEFAULT_DATABASE_HISTORY      "HISTORY_DB"
 
@@ -178,6 +178,11 @@ void otai_deserialize_number(
         _Out_ uint64_t& number,
         _In_ bool hex = false);
 
+void otai_deserialize_hex_binary(
+        _In_ const std::string &s,
+        _Out_ void *buffer,
+        _In_ size_t length);
+
 void otai_deserialize_status(
         _In_ const std::string& s,
         _Out_ otai_status_t& status);
@@ -0,0 +1,509 @@
+#include "AlarmDamping.h"
+
+#include "meta/otai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <fstream>
+
+using namespace syncd;
+
+#define ALARM_DAMPING_DEFAULT_FLAP_WINDOW_MS 60000
+
+AlarmDamping::AlarmDamping()
+{
+    SWSS_LOG_ENTER();
+
+    m_defaultConfig.m_holdDownMs = 0;
+    m_defaultConfig.m_flapThreshold = 0;
+    m_defaultConfig.m_flapWindowMs = ALARM_DAMPING_DEFAULT_FLAP_WINDOW_MS;
+    m_defaultConfig.m_maxRate = 0;
+
+    m_lastPublish = TimePoint();
+}
+
+void AlarmDamping::parseConfig(
+        _In_ const nlohmann::json& j,
+        _Inout_ AlarmDampingConfig& config)
+{
+    SWSS_LOG_ENTER();
+
+    if (!j.is_object())
+    {
+        SWSS_LOG_THROW("alarm damping config entry is not object: %s", j.dump().c_str());
+    }
+
+    // missing fields keep value from given config
+
+    const std::pair<const char*, uint32_t*> fields[] = {
+        { "hold-down-ms", &config.m_holdDownMs },
+        { "flap-threshold", &config.m_flapThreshold },
+        { "flap-window-ms", &config.m_flapWindowMs },
+        { "max-rate", &config.m_maxRate } };
+
+    for (auto& field: fields)
+    {
+        auto it = j.find(field.first);
+
+        if (it != j.end())
+        {
+            *field.second = it->get<uint32_t>();
+        }
+    }
+}
+
+void AlarmDamping::loadConfig(
+        _In_ const std::string& path)
+{
+    SWSS_LOG_ENTER();
+
+    std::ifstream file(path);
+
+    if (!file.is_open())
+    {
+        SWSS_LOG_THROW("failed to open alarm damping config %s", path.c_str());
+    }
+
+    nlohmann::json j;
+
+    try
+    {
+        file >> j;
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_THROW("failed to parse alarm damping config %s: %s", path.c_str(), e.what());
+    }
+
+    if (!j.is_object())
+    {
+        SWSS_LOG_THROW("alarm damping config %s is not json object", path.c_str());
+    }
+
+    auto def = j.find("default");
+
+    if (def != j.end())
+    {
+        parseConfig(*def, m_defaultConfig);
+    }
+
+    m_configs.clear();
+
+    for (auto it = j.begin(); it != j.end(); it++)
+    {
+        if (it.key() == "default")
+        {
+            continue;
+        }
+
+        AlarmDampingConfig config = m_defaultConfig;
+
+        parseConfig(it.value(), config);
+
+        m_configs[it.key()] = config;
+    }
+
+    SWSS_LOG_NOTICE("loaded alarm damping config %s with %zu alarm types", path.c_str(), m_configs.size());
+}
+
+const AlarmDampingConfig& AlarmDamping::getConfig(
+        _In_ const std::string& typeId) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_configs.find(typeId);
+
+    if (it == m_configs.end())
+    {
+        return m_defaultConfig;
+    }
+
+    return it->second;
+}
+
+void AlarmDamping::hold(
+        _In_ const std::string& alarmId,
+        _Inout_ State& state,
+        _In_ TimePoint deadline)
+{
+    SWSS_LOG_ENTER();
+
+    unschedule(state);
+
+    state.m_held = true;
+    state.m_deadline = deadline;
+    state.m_timer = m_deadlines.emplace(deadline, alarmId);
+}
+
+void AlarmDamping::unschedule(
+        _Inout_ State& state)
+{
+    SWSS_LOG_ENTER();
+
+    if (state.m_held)
+    {
+        m_deadlines.erase(state.m_timer);
+    }
+    else if (state.m_idle)
+    {
+        m_idleStates.erase(state.m_timer);
+    }
+
+    state.m_held = false;
+    state.m_idle = false;
+}
+
+void AlarmDamping::scheduleRemoval(
+        _In_ const std::string& alarmId,
+        _Inout_ State& state,
+        _In_ TimePoint now)
+{
+    SWSS_LOG_ENTER();
+
+    unschedule(state);
+
+    // transitions within window are still needed for flap detection
+
+    state.m_idle = true;
+    state.m_timer = m_idleStates.emplace(std::max(now, state.m_windowEnd), alarmId);
+}
+
+bool AlarmDamping::takeToken(
+        _In_ const std::string& resource,
+        _In_ uint32_t rate,
+        _In_ TimePoint now,
+        _Out_ std::chrono::milliseconds& wait)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_buckets.find(resource);
+
+    if (it == m_buckets.end())
+    {
+        it = m_buckets.emplace(resource, Bucket{ (double)rate, now, m_idleBuckets.end() }).first;
+    }
+    else
+    {
+        m_idleBuckets.erase(it->second.m_timer);
+    }
+
+    auto& bucket = it->second;
+
+    // bucket holds at most one second of transitions
+
+    double elapsed = std::chrono::duration<double>(now - bucket.m_last).count();
+
+    bucket.m_tokens = std::min((double)rate, bucket.m_tokens + elapsed * rate);
+    bucket.m_last = now;
+
+    bool taken = (bucket.m_tokens >= 1.0);
+
+    if (taken)
+    {
+        bucket.m_tokens -= 1.0;
+
+        wait = std::chrono::milliseconds(0);
+    }
+    else
+    {
+        wait = std::chrono::milliseconds((int64_t)((1.0 - bucket.m_tokens) * 1000.0 / rate) + 1);
+    }
+
+    // full bucket is same as new one, it is removed when full again
+
+    auto full = std::chrono::milliseconds((int64_t)(((double)rate - bucket.m_tokens) * 1000.0 / rate) + 1);
+
+    bucket.m_timer = m_idleBuckets.emplace(now + full, resource);
+
+    return taken;
+}
+
+AlarmDampingAction AlarmDamping::onTransition(
+        _In_ const std::string& alarmId,
+        _In_ const std::string& typeId,
+        _In_ const std::string& resource,
+        _In_ bool active,
+        _In_ TimePoint now)
+{
+    SWSS_LOG_ENTER();
+
+    auto& config = getConfig(typeId);
+
+    auto it = m_states.find(alarmId);
+
+    if (it == m_states.end())
+    {
+        it = m_states.emplace(alarmId, State{ false, false, now, {}, now, 0, 0, 0, 0, false, m_deadlines.end() }).first;
+    }
+
+    auto& state = it->second;
+
+    if (state.m_idle)
+    {
+        unschedule(state);
+    }
+
+    state.m_transitionCount++;
+
+    m_changed.insert(alarmId);
+
+    auto window = std::chrono::milliseconds(config.m_flapWindowMs);
+
+    if (config.m_flapThreshold)
+    {
+        state.m_transitions.push_back(now);
+        state.m_windowEnd = now + window;
+
+        while (state.m_transitions.size() && state.m_transitions.front() + window < now)
+        {
+            state.m_transitions.pop_front();
+        }
+    }
+
+    if (state.m_flapping)
+    {
+        // flapping ends only after whole window without transition
+
+        hold(alarmId, state, now + window);
+
+        state.m_suppressedCount++;
+
+        return ALARM_DAMPING_ACTION_SUPPRESS;
+    }
+
+    if (config.m_flapThreshold && state.m_transitions.size() >= config.m_flapThreshold)
+    {
+        SWSS_LOG_WARN("alarm %s is flapping, %zu transitions within %u ms",
+                alarmId.c_str(),
+                state.m_transitions.size(),
+                config.m_flapWindowMs);
+
+        hold(alarmId, state, now + window);
+
+        state.m_flapping = true;
+        state.m_suppressedCount++;
+
+        return ALARM_DAMPING_ACTION_FLAPPING;
+    }
+
+    auto holdDown = std::chrono::milliseconds(config.m_holdDownMs);
+
+    if (state.m_held)
+    {
+        // latest transition is applied on expiry, clear restarts hold-down
+
+        if (!active && config.m_holdDownMs && state.m_deadline < now + holdDown)
+        {
+            hold(alarmId, state, now + holdDown);
+        }
+
+        state.m_suppressedCount++;
+
+        return ALARM_DAMPING_ACTION_SUPPRESS;
+    }
+
+    if (!active && config.m_holdDownMs)
+    {
+        hold(alarmId, state, now + holdDown);
+
+        state.m_suppressedCount++;
+
+        return ALARM_DAMPING_ACTION_SUPPRESS;
+    }
+
+    std::chrono::milliseconds wait;
+
+    if (config.m_maxRate && !takeToken(resource, config.m_maxRate, now, wait))
+    {
+        hold(alarmId, state, now + wait);
+
+        state.m_suppressedCount++;
+
+        return ALARM_DAMPING_ACTION_SUPPRESS;
+    }
+
+    return ALARM_DAMPING_ACTION_APPLY;
+}
+
+std::vector<AlarmDampingExpiry> AlarmDamping::getExpired(
+        _In_ TimePoint now)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<AlarmDampingExpiry> expired;
+
+    while (m_deadlines.size() && m_deadlines.begin()->first <= now)
+    {
+        std::string alarmId = m_deadlines.begin()->second;
+
+        auto& state = m_states.at(alarmId);
+
+        expired.push_back({ alarmId, state.m_flapping });
+
+        unschedule(state);
+
+        if (state.m_flapping)
+        {
+            SWSS_LOG_NOTICE("alarm %s stopped flapping", alarmId.c_str());
+
+            m_changed.insert(alarmId);
+        }
+
+        state.m_flapping = false;
+        state.m_transitions.clear();
+        state.m_windowEnd = now;
+
+        if (m_changed.find(alarmId) == m_changed.end())
+        {
+            scheduleRemoval(alarmId, state, now);
+        }
+    }
+
+    while (m_idleStates.size() && m_idleStates.begin()->first <= now)
+    {
+        m_states.erase(m_idleStates.begin()->second);
+
+        m_idleStates.erase(m_idleStates.begin());
+    }
+
+    while (m_idleBuckets.size() && m_idleBuckets.begin()->first <= now)
+    {
+        m_buckets.erase(m_idleBuckets.begin()->second);
+
+        m_idleBuckets.erase(m_idleBuckets.begin());
+    }
+
+    return expired;
+}
+
+uint64_t AlarmDamping::getTransitionCount(
+        _In_ const std::string& alarmId) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_states.find(alarmId);
+
+    return (it == m_states.end()) ? 0 : it->second.m_transitionCount;
+}
+
+bool AlarmDamping::resetState(
+        _In_ const std::string& alarmId,
+        _Inout_ State& state)
+{
+    SWSS_LOG_ENTER();
+
+    if (state.m_flapping)
+    {
+        // published flapping state must be updated
+
+        m_changed.insert(alarmId);
+    }
+
+    unschedule(state);
+
+    state.m_flapping = false;
+    state.m_transitions.clear();
+    state.m_windowEnd = TimePoint();
+
+    // states with counts not yet reported are removed after report
+
+    return m_changed.find(alarmId) == m_changed.end();
+}
+
+void AlarmDamping::clear()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto it = m_states.begin(); it != m_states.end();)
+    {
+        if (resetState(it->first, it->second))
+        {
+            it = m_states.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+
+    m_deadlines.clear();
+    m_idleStates.clear();
+
+    m_buckets.clear();
+    m_idleBuckets.clear();
+}
+
+void AlarmDamping::clear(
+        _In_ const std::vector<std::string>& alarmIds)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& alarmId: alarmIds)
+    {
+        auto it = m_states.find(alarmId);
+
+        if (it != m_states.end() && resetState(it->first, it->second))
+        {
+            m_states.erase(it);
+        }
+    }
+}
+
+AlarmDamping::TimePoint AlarmDamping::getNextDeadline() const
+{
+    SWSS_LOG_ENTER();
+
+    TimePoint deadline = TimePoint::max();
+
+    if (m_changed.size())
+    {
+        deadline = m_lastPublish + std::chrono::milliseconds(ALARM_DAMPING_PUBLISH_INTERVAL_MS);
+    }
+
+    for (auto timers: { &m_deadlines, &m_idleStates, &m_idleBuckets })
+    {
+        if (timers->size())
+        {
+            deadline = std::min(deadline, timers->begin()->first);
+        }
+    }
+
+    return deadline;
+}
+
+std::map<std::string, AlarmDampingStatistics> AlarmDamping::getChangedStatistics(
+        _In_ TimePoint now)
+{
+    SWSS_LOG_ENTER();
+
+    std::map<std::string, AlarmDampingStatistics> statistics;
+
+    if (now < m_lastPublish + std::chrono::milliseconds(ALARM_DAMPING_PUBLISH_INTERVAL_MS))
+    {
+        return statistics;
+    }
+
+    for (auto& alarmId: m_changed)
+    {
+        auto& state = m_states.at(alarmId);
+
+        statistics[alarmId] = {
+            state.m_transitionCount - state.m_reportedTransitionCount,
+            state.m_suppressedCount - state.m_reportedSuppressedCount,
+            state.m_flapping };
+
+        state.m_reportedTransitionCount = state.m_transitionCount;
+        state.m_reportedSuppressedCount = state.m_suppressedCount;
+
+        if (!state.m_held)
+        {
+            scheduleRemoval(alarmId, state, now);
+        }
+    }
+
+    m_changed.clear();
+
+    m_lastPublish = now;
+
+    return statistics;
+}
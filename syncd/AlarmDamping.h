@@ -0,0 +1,332 @@
+#pragma once
+
+#include "swss/table.h"
+
+#include "nlohmann/json.hpp"
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <chrono>
+
+/*
+ * STATE DB table with raw transition counts and damping state per alarm id.
+ */
+#define ALARM_DAMPING_TABLE "ALARM_DAMPING"
+
+/*
+ * Raw transition counts are published at most once per this interval.
+ */
+#define ALARM_DAMPING_PUBLISH_INTERVAL_MS 1000
+
+namespace syncd
+{
+    typedef struct _AlarmDampingConfig
+    {
+        /**
+         * @brief Clear is applied only when alarm is not raised again
+         * within this time, 0 disables hold-down.
+         */
+        uint32_t m_holdDownMs;
+
+        /**
+         * @brief Number of transitions within flap window after which alarm
+         * is flapping, 0 disables flap detection.
+         */
+        uint32_t m_flapThreshold;
+
+        /**
+         * @brief Flap window, alarm stops flapping after this time without
+         * transition.
+         */
+        uint32_t m_flapWindowMs;
+
+        /**
+         * @brief Maximum number of applied transitions per second per
+         * resource, 0 is unlimited.
+         */
+        uint32_t m_maxRate;
+
+    } AlarmDampingConfig;
+
+    typedef enum _AlarmDampingAction
+    {
+        /**
+         * @brief Transition is applied now.
+         */
+        ALARM_DAMPING_ACTION_APPLY,
+
+        /**
+         * @brief Transition is held, latest transition is applied when
+         * alarm expires.
+         */
+        ALARM_DAMPING_ACTION_SUPPRESS,
+
+        /**
+         * @brief Alarm started flapping, transitions are held until flapping
+         * stops.
+         */
+        ALARM_DAMPING_ACTION_FLAPPING,
+
+    } AlarmDampingAction;
+
+    typedef struct _AlarmDampingExpiry
+    {
+        std::string m_alarmId;
+
+        bool m_flapEnded;
+
+    } AlarmDampingExpiry;
+
+    typedef struct _AlarmDampingStatistics
+    {
+        /**
+         * @brief Transitions since previous statistics of this alarm.
+         */
+        uint64_t m_transitionCount;
+
+        /**
+         * @brief Suppressed transitions since previous statistics of this
+         * alarm.
+         */
+        uint64_t m_suppressedCount;
+
+        bool m_flapping;
+
+    } AlarmDampingStatistics;
+
+    /**
+     * @brief Alarm storm damping.
+     *
+     * Decides for each raise and clear of alarm whether it is applied to
+     * current alarm table now or held. Clear is held for hold-down time,
+     * transitions of flapping alarm are held until alarm is quiet for flap
+     * window, and applied transitions are rate limited per resource by token
+     * bucket. Held alarm expires at its deadline and its latest transition is
+     * applied by caller, so current alarm table always converges to latest
+     * state.
+     *
+     * Configuration is json file with per alarm type-id objects and
+     * "default" object, with fields "hold-down-ms", "flap-threshold",
+     * "flap-window-ms" and "max-rate". Missing fields are taken from
+     * default. Without configuration all transitions are applied.
+     *
+     * Raw transition and suppression counts are reported as increments since
+     * previous statistics. State of alarm id is removed when alarm is not
+     * held, its flap window ended and its counts were reported, and rate
+     * limit bucket is removed when it is full again, so memory is bounded by
+     * recently active alarms. Held alarms are kept ordered by deadline.
+     *
+     * Not thread safe, used by notification processing thread only.
+     */
+    class AlarmDamping
+    {
+        public:
+
+            typedef std::chrono::steady_clock::time_point TimePoint;
+
+        public:
+
+            AlarmDamping();
+
+            virtual ~AlarmDamping() = default;
+
+        public:
+
+            /**
+             * @brief Load configuration, throws on invalid file.
+             */
+            void loadConfig(
+                    _In_ const std::string& path);
+
+            AlarmDampingAction onTransition(
+                    _In_ const std::string& alarmId,
+                    _In_ const std::string& typeId,
+                    _In_ const std::string& resource,
+                    _In_ bool active,
+                    _In_ TimePoint now);
+
+            /**
+             * @brief Get held alarms which deadline passed and remove idle
+             * alarm states and buckets.
+             */
+            std::vector<AlarmDampingExpiry> getExpired(
+                    _In_ TimePoint now);
+
+            /**
+             * @brief Get transitions of alarm since its state was created.
+             */
+            uint64_t getTransitionCount(
+                    _In_ const std::string& alarmId) const;
+
+            /**
+             * @brief Drop held transitions, flapping state and rate limit
+             * buckets of all alarms, counts not yet reported are kept.
+             */
+            void clear();
+
+            /**
+             * @brief Drop held transitions and flapping state of given
+             * alarms, counts not yet reported are kept.
+             */
+            void clear(
+                    _In_ const std::vector<std::string>& alarmIds);
+
+            /**
+             * @brief Get time of nearest expiry, idle state removal or
+             * statistics publish.
+             *
+             * Returns TimePoint::max() when nothing is pending.
+             */
+            TimePoint getNextDeadline() const;
+
+            /**
+             * @brief Get statistics of alarms changed since last call.
+             */
+            std::map<std::string, AlarmDampingStatistics> getChangedStatistics(
+                    _In_ TimePoint now);
+
+        private:
+
+            /**
+             * @brief Alarm ids or resources ordered by time.
+             */
+            typedef std::multimap<TimePoint, std::string> Timers;
+
+            typedef struct _State
+            {
+                bool m_held;
+
+                bool m_flapping;
+
+                TimePoint m_deadline;
+
+                /**
+                 * @brief Times of transitions within flap window.
+                 */
+                std::deque<TimePoint> m_transitions;
+
+                /**
+                 * @brief End of flap window of latest transition.
+                 */
+                TimePoint m_windowEnd;
+
+                uint64_t m_transitionCount;
+
+                uint64_t m_suppressedCount;
+
+                uint64_t m_reportedTransitionCount;
+
+                uint64_t m_reportedSuppressedCount;
+
+                /**
+                 * @brief State is waiting for removal in m_idleStates.
+                 */
+                bool m_idle;
+
+                /**
+                 * @brief Entry in m_deadlines when held, in m_idleStates
+                 * when idle.
+                 */
+                Timers::iterator m_timer;
+
+            } State;
+
+            typedef struct _Bucket
+            {
+                double m_tokens;
+
+                TimePoint m_last;
+
+                /**
+                 * @brief Entry in m_idleBuckets at time bucket is full.
+                 */
+                Timers::iterator m_timer;
+
+            } Bucket;
+
+            const AlarmDampingConfig& getConfig(
+                    _In_ const std::string& typeId) const;
+
+            /**
+             * @brief Take token from resource bucket.
+             *
+             * Returns false and time until token is available when bucket is
+             * empty.
+             */
+            bool takeToken(
+                    _In_ const std::string& resource,
+                    _In_ uint32_t rate,
+                    _In_ TimePoint now,
+                    _Out_ std::chrono::milliseconds& wait);
+
+            /**
+             * @brief Hold alarm until given deadline.
+             */
+            void hold(
+                    _In_ const std::string& alarmId,
+                    _Inout_ State& state,
+                    _In_ TimePoint deadline);
+
+            /**
+             * @brief Remove alarm state from deadline or idle timers.
+             */
+            void unschedule(
+                    _Inout_ State& state);
+
+            /**
+             * @brief Schedule removal of alarm state at end of its flap
+             * window, state must not be held and must be reported.
+             */
+            void scheduleRemoval(
+                    _In_ const std::string& alarmId,
+                    _Inout_ State& state,
+                    _In_ TimePoint now);
+
+            /**
+             * @brief Reset held and flapping state of alarm.
+             *
+             * Returns true when state has no counts to report and can be
+             * removed.
+             */
+            bool resetState(
+                    _In_ const std::string& alarmId,
+                    _Inout_ State& state);
+
+            static void parseConfig(
+                    _In_ const nlohmann::json& j,
+                    _Inout_ AlarmDampingConfig& config);
+
+        private:
+
+            AlarmDampingConfig m_defaultConfig;
+
+            std::map<std::string, AlarmDampingConfig> m_configs;
+
+            std::unordered_map<std::string, State> m_states;
+
+            std::unordered_map<std::string, Bucket> m_buckets;
+
+            /**
+             * @brief Held alarms by deadline.
+             */
+            Timers m_deadlines;
+
+            /**
+             * @brief Idle alarm states by removal time.
+             */
+            Timers m_idleStates;
+
+            /**
+             * @brief Rate limit buckets by time they are full again.
+             */
+            Timers m_idleBuckets;
+
+            std::set<std::string> m_changed;
+
+            TimePoint m_lastPublish;
+    };
+}
@@ -0,0 +1,470 @@
+#include "AsicStateJournal.h"
+
+#include "meta/otai_serialize.h"
+
+#include "swss/logger.h"
+
+#include "nlohmann/json.hpp"
+
+#include <fstream>
+#include <algorithm>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <stdio.h>
+#include <inttypes.h>
+
+using namespace syncd;
+using json = nlohmann::json;
+
+AsicStateJournal::AsicStateJournal(
+        _In_ const std::string& directory,
+        _In_ std::shared_ptr<RedisClient> client):
+    m_journalPath(directory + "/" ASIC_STATE_JOURNAL_FILE),
+    m_snapshotPath(directory + "/" ASIC_STATE_SNAPSHOT_FILE),
+    m_directory(directory),
+    m_client(client),
+    m_fd(-1),
+    m_sequence(0),
+    m_recordsSinceSnapshot(0),
+    m_pendingCount(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+AsicStateJournal::~AsicStateJournal()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_fd >= 0)
+    {
+        commit();
+
+        close(m_fd);
+    }
+}
+
+bool AsicStateJournal::writeAll(
+        _In_ int fd,
+        _In_ const std::string& data)
+{
+    SWSS_LOG_ENTER();
+
+    const char* ptr = data.data();
+
+    size_t left = data.size();
+
+    while (left)
+    {
+        ssize_t written = write(fd, ptr, left);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            SWSS_LOG_ERROR("write failed: %s", strerror(errno));
+
+            return false;
+        }
+
+        ptr += written;
+        left -= (size_t)written;
+    }
+
+    return true;
+}
+
+uint64_t AsicStateJournal::recoverSnapshot()
+{
+    SWSS_LOG_ENTER();
+
+    std::ifstream file(m_snapshotPath);
+
+    std::string line;
+
+    if (!file.is_open() || !std::getline(file, line))
+    {
+        SWSS_LOG_NOTICE("no ASIC state snapshot found");
+
+        return 0;
+    }
+
+    uint64_t sequence = json::parse(line).at("seq").get<uint64_t>();
+
+    if (!m_client->getAsicStateKeys().empty())
+    {
+        // ASIC DB survived, only journal tail needs to be replayed
+
+        return sequence;
+    }
+
+    SWSS_LOG_TIMER("load ASIC state snapshot");
+
+    std::unordered_map<std::string, std::vector<swss::FieldValueTuple>> multiHash;
+
+    std::vector<std::pair<otai_object_id_t, otai_object_id_t>> vidRidPairs;
+
+    while (std::getline(file, line))
+    {
+        json j = json::parse(line);
+
+        const std::string key = j.at("key");
+
+        std::vector<swss::FieldValueTuple> values;
+
+        for (auto& fv: j.at("attrs"))
+        {
+            values.emplace_back(fv.at(0).get<std::string>(), fv.at(1).get<std::string>());
+        }
+
+        multiHash[key] = values;
+
+        otai_object_meta_key_t metaKey;
+        otai_deserialize_object_meta_key(key, metaKey);
+
+        otai_object_id_t rid;
+        otai_deserialize_object_id(j.at("rid").get<std::string>(), rid);
+
+        if (rid != OTAI_NULL_OBJECT_ID)
+        {
+            vidRidPairs.emplace_back(metaKey.objectkey.key.object_id, rid);
+        }
+    }
+
+    m_client->createAsicObjects(multiHash);
+    m_client->insertVidsAndRids(vidRidPairs);
+
+    SWSS_LOG_NOTICE("loaded %zu objects from ASIC state snapshot at sequence %" PRIu64,
+            multiHash.size(),
+            sequence);
+
+    return sequence;
+}
+
+void AsicStateJournal::apply(
+        _In_ const nlohmann::json& j)
+{
+    SWSS_LOG_ENTER();
+
+    const std::string op = j.at("op");
+
+    otai_object_meta_key_t metaKey;
+    otai_deserialize_object_meta_key(j.at("key").get<std::string>(), metaKey);
+
+    otai_object_id_t vid = metaKey.objectkey.key.object_id;
+
+    std::vector<swss::FieldValueTuple> values;
+
+    for (auto& fv: j.at("attrs"))
+    {
+        values.emplace_back(fv.at(0).get<std::string>(), fv.at(1).get<std::string>());
+    }
+
+    if (op == "create")
+    {
+        otai_object_id_t rid;
+        otai_deserialize_object_id(j.at("rid").get<std::string>(), rid);
+
+        m_client->createAsicObject(metaKey, values);
+
+        if (rid != OTAI_NULL_OBJECT_ID)
+        {
+            m_client->insertVidAndRid(vid, rid);
+        }
+    }
+    else if (op == "set")
+    {
+        auto& fv = values.at(0);
+
+        m_client->setAsicObject(metaKey, fvField(fv), fvValue(fv));
+    }
+    else if (op == "remove")
+    {
+        otai_object_id_t rid = m_client->getRidForVid(vid);
+
+        m_client->removeAsicObject(metaKey);
+
+        if (rid != OTAI_NULL_OBJECT_ID)
+        {
+            m_client->removeVidAndRid(vid, rid);
+        }
+    }
+    else
+    {
+        SWSS_LOG_THROW("unknown journal op: %s", op.c_str());
+    }
+}
+
+void AsicStateJournal::recover()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("ASIC state journal recovery");
+
+    uint64_t snapshotSequence = recoverSnapshot();
+
+    m_sequence = snapshotSequence;
+
+    std::ifstream file(m_journalPath);
+
+    std::string line;
+
+    uint64_t replayed = 0;
+
+    std::streamoff validSize = 0;
+
+    while (file.is_open() && std::getline(file, line))
+    {
+        json j;
+
+        uint64_t sequence;
+
+        try
+        {
+            if (file.eof())
+            {
+                // last line without new line was not fully written
+
+                SWSS_LOG_THROW("missing record terminator");
+            }
+
+            j = json::parse(line);
+
+            sequence = j.at("seq").get<uint64_t>();
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_WARN("dropping partial journal record after sequence %" PRIu64 ": %s",
+                    m_sequence,
+                    e.what());
+
+            break;
+        }
+
+        if (sequence > snapshotSequence)
+        {
+            apply(j);
+
+            replayed++;
+        }
+
+        m_sequence = std::max(m_sequence, sequence);
+
+        validSize = file.tellg();
+    }
+
+    file.close();
+
+    m_recordsSinceSnapshot = replayed;
+
+    m_fd = open(m_journalPath.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+
+    if (m_fd < 0)
+    {
+        SWSS_LOG_THROW("failed to open journal %s: %s", m_journalPath.c_str(), strerror(errno));
+    }
+
+    if (ftruncate(m_fd, validSize) != 0)
+    {
+        SWSS_LOG_THROW("failed to truncate journal %s: %s", m_journalPath.c_str(), strerror(errno));
+    }
+
+    SWSS_LOG_NOTICE("replayed %" PRIu64 " journal records after snapshot sequence %" PRIu64 ", last sequence %" PRIu64,
+            replayed,
+            snapshotSequence,
+            m_sequence);
+}
+
+void AsicStateJournal::append(
+        _In_ const std::string& op,
+        _In_ const otai_object_meta_key_t& metaKey,
+        _In_ otai_object_id_t rid,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_fd < 0)
+    {
+        SWSS_LOG_THROW("journal %s was not recovered", m_journalPath.c_str());
+    }
+
+    json j;
+
+    j["seq"] = ++m_sequence;
+    j["op"] = op;
+    j["key"] = otai_serialize_object_meta_key(metaKey);
+    j["rid"] = otai_serialize_object_id(rid);
+    j["attrs"] = json::array();
+
+    for (auto& fv: values)
+    {
+        j["attrs"].push_back(json::array({ fvField(fv), fvValue(fv) }));
+    }
+
+    m_pending += j.dump();
+    m_pending += "\n";
+
+    m_pendingCount++;
+    m_recordsSinceSnapshot++;
+
+    if (m_pendingCount >= ASIC_STATE_JOURNAL_GROUP_COMMIT_SIZE)
+    {
+        commit();
+    }
+}
+
+void AsicStateJournal::create(
+        _In_ const otai_object_meta_key_t& metaKey,
+        _In_ otai_object_id_t rid,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    append("create", metaKey, rid, values);
+}
+
+void AsicStateJournal::set(
+        _In_ const otai_object_meta_key_t& metaKey,
+        _In_ const std::string& attr,
+        _In_ const std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+    append("set", metaKey, OTAI_NULL_OBJECT_ID, { { attr, value } });
+}
+
+void AsicStateJournal::remove(
+        _In_ const otai_object_meta_key_t& metaKey)
+{
+    SWSS_LOG_ENTER();
+
+    append("remove", metaKey, OTAI_NULL_OBJECT_ID, {});
+}
+
+void AsicStateJournal::commit()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pendingCount == 0)
+    {
+        return;
+    }
+
+    // journal is best effort, syncd keeps running when disk fails, records
+    // are dropped so they are not duplicated on next commit
+
+    if (writeAll(m_fd, m_pending) && fdatasync(m_fd) != 0)
+    {
+        SWSS_LOG_ERROR("failed to sync journal %s: %s", m_journalPath.c_str(), strerror(errno));
+    }
+
+    SWSS_LOG_DEBUG("committed %u journal records", m_pendingCount);
+
+    m_pending.clear();
+    m_pendingCount = 0;
+}
+
+bool AsicStateJournal::isSnapshotNeeded() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_recordsSinceSnapshot >= ASIC_STATE_JOURNAL_SNAPSHOT_INTERVAL;
+}
+
+void AsicStateJournal::snapshot()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("ASIC state snapshot");
+
+    commit();
+
+    auto keys = m_client->getAsicStateKeys();
+
+    auto values = m_client->getAttributesFromAsicKeys(keys);
+
+    auto vidToRid = m_client->getVidToRidMap();
+
+    std::string data = json{ { "seq", m_sequence } }.dump() + "\n";
+
+    for (size_t idx = 0; idx < keys.size(); idx++)
+    {
+        // snapshot keys are without ASIC state table prefix, same as journal
+
+        std::string key = keys[idx].substr(keys[idx].find(":") + 1);
+
+        otai_object_meta_key_t metaKey;
+        otai_deserialize_object_meta_key(key, metaKey);
+
+        auto it = vidToRid.find(metaKey.objectkey.key.object_id);
+
+        json j;
+
+        j["key"] = key;
+        j["rid"] = otai_serialize_object_id(it == vidToRid.end() ? OTAI_NULL_OBJECT_ID : it->second);
+        j["attrs"] = json::array();
+
+        for (auto& fv: values[idx])
+        {
+            j["attrs"].push_back(json::array({ fvField(fv), fvValue(fv) }));
+        }
+
+        data += j.dump();
+        data += "\n";
+    }
+
+    std::string tmpPath = m_snapshotPath + ".tmp";
+
+    int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (fd < 0)
+    {
+        SWSS_LOG_ERROR("failed to open %s: %s", tmpPath.c_str(), strerror(errno));
+
+        return;
+    }
+
+    bool success = writeAll(fd, data) && fsync(fd) == 0;
+
+    close(fd);
+
+    // snapshot must be durable before journal records it covers are dropped
+
+    if (!success || rename(tmpPath.c_str(), m_snapshotPath.c_str()) != 0)
+    {
+        SWSS_LOG_ERROR("failed to write snapshot %s: %s", m_snapshotPath.c_str(), strerror(errno));
+
+        unlink(tmpPath.c_str());
+
+        return;
+    }
+
+    int dirFd = open(m_directory.c_str(), O_RDONLY | O_DIRECTORY);
+
+    if (dirFd >= 0)
+    {
+        fsync(dirFd);
+        close(dirFd);
+    }
+
+    if (ftruncate(m_fd, 0) != 0)
+    {
+        // records are still skipped on recovery by sequence number
+
+        SWSS_LOG_ERROR("failed to truncate journal %s: %s", m_journalPath.c_str(), strerror(errno));
+    }
+
+    m_recordsSinceSnapshot = 0;
+
+    SWSS_LOG_NOTICE("ASIC state snapshot with %zu objects at sequence %" PRIu64,
+            keys.size(),
+            m_sequence);
+}
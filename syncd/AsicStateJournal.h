@@ -0,0 +1,130 @@
+#pragma once
+
+extern "C" {
+#include "otaimetadata.h"
+}
+
+#include "RedisClient.h"
+
+#include "swss/table.h"
+
+#include "nlohmann/json.hpp"
+
+#include <string>
+#include <vector>
+#include <memory>
+
+/*
+ * Pending records are written and synced to disk at most when this many
+ * records were appended, syncd also commits when there are no more requests
+ * in queue.
+ */
+#define ASIC_STATE_JOURNAL_GROUP_COMMIT_SIZE 256
+
+/*
+ * Number of records after which journal is compacted into snapshot.
+ */
+#define ASIC_STATE_JOURNAL_SNAPSHOT_INTERVAL 10000
+
+#define ASIC_STATE_JOURNAL_FILE  "asic_state.journal"
+#define ASIC_STATE_SNAPSHOT_FILE "asic_state.snapshot"
+
+namespace syncd
+{
+    /**
+     * @brief Append only journal of ASIC DB changes applied by syncd.
+     *
+     * Each create, set and remove which succeeded on vendor is appended as
+     * single line record with sequence number. Records are buffered and
+     * written with single write and fdatasync (group commit).
+     *
+     * Periodically whole ASIC state together with RIDs is written to
+     * snapshot file and journal is truncated, so on recovery only records
+     * with sequence number past the snapshot are replayed to ASIC DB. If
+     * ASIC DB is empty (redis was restarted as well), snapshot is loaded
+     * first.
+     */
+    class AsicStateJournal
+    {
+        public:
+
+            AsicStateJournal(
+                    _In_ const std::string& directory,
+                    _In_ std::shared_ptr<RedisClient> client);
+
+            virtual ~AsicStateJournal();
+
+        public:
+
+            /**
+             * @brief Replay snapshot and journal tail to ASIC DB.
+             *
+             * Must be called before any record is appended. Partially written
+             * last record is dropped.
+             */
+            void recover();
+
+            void create(
+                    _In_ const otai_object_meta_key_t& metaKey,
+                    _In_ otai_object_id_t rid,
+                    _In_ const std::vector<swss::FieldValueTuple>& values);
+
+            void set(
+                    _In_ const otai_object_meta_key_t& metaKey,
+                    _In_ const std::string& attr,
+                    _In_ const std::string& value);
+
+            void remove(
+                    _In_ const otai_object_meta_key_t& metaKey);
+
+            /**
+             * @brief Write and sync all pending records.
+             */
+            void commit();
+
+            bool isSnapshotNeeded() const;
+
+            /**
+             * @brief Write current ASIC DB state to snapshot and truncate
+             * journal.
+             */
+            void snapshot();
+
+        private:
+
+            void append(
+                    _In_ const std::string& op,
+                    _In_ const otai_object_meta_key_t& metaKey,
+                    _In_ otai_object_id_t rid,
+                    _In_ const std::vector<swss::FieldValueTuple>& values);
+
+            uint64_t recoverSnapshot();
+
+            void apply(
+                    _In_ const nlohmann::json& record);
+
+            static bool writeAll(
+                    _In_ int fd,
+                    _In_ const std::string& data);
+
+        private:
+
+            std::string m_journalPath;
+
+            std::string m_snapshotPath;
+
+            std::string m_directory;
+
+            std::shared_ptr<RedisClient> m_client;
+
+            int m_fd;
+
+            uint64_t m_sequence;
+
+            uint64_t m_recordsSinceSnapshot;
+
+            std::string m_pending;
+
+            uint32_t m_pendingCount;
+    };
+}
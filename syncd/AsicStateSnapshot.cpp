@@ -0,0 +1,144 @@
+#include "AsicStateSnapshot.h"
+
+#include "meta/otai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+using namespace syncd;
+using namespace otaimeta;
+
+/*
+ * Number of keys parsed by single worker at once, and maximum number of
+ * parsing threads.
+ */
+#define ASIC_STATE_SNAPSHOT_PARSE_CHUNK     256
+#define ASIC_STATE_SNAPSHOT_MAX_THREADS     8
+
+AsicStateSnapshot::AsicStateSnapshot(
+        _In_ std::shared_ptr<RedisClient> client,
+        _In_ const std::vector<std::string>& asicKeys):
+    m_client(client),
+    m_asicKeys(asicKeys)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+otai_object_type_t AsicStateSnapshot::getObjectTypeFromAsicKey(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    auto start = key.find_first_of(":") + 1;
+    auto end = key.find(":", start);
+
+    const std::string strObjectType = key.substr(start, end - start);
+
+    otai_object_type_t objectType;
+    otai_deserialize_object_type(strObjectType, objectType);
+
+    if (!otai_metadata_is_object_type_valid(objectType))
+    {
+        SWSS_LOG_THROW("invalid object type: %s on asic key: %s",
+                otai_serialize_object_type(objectType).c_str(),
+                key.c_str());
+    }
+
+    return objectType;
+}
+
+AsicStateSnapshot::AttributesLists AsicStateSnapshot::load()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("load asic state snapshot %zu keys", m_asicKeys.size());
+
+    auto values = m_client->getAttributesFromAsicKeys(m_asicKeys);
+
+    std::vector<std::shared_ptr<OtaiAttributeList>> lists(m_asicKeys.size());
+
+    std::vector<std::string> errors(m_asicKeys.size());
+
+    std::atomic<size_t> next(0);
+
+    auto worker = [&]()
+    {
+        while (true)
+        {
+            size_t start = next.fetch_add(ASIC_STATE_SNAPSHOT_PARSE_CHUNK);
+
+            if (start >= m_asicKeys.size())
+            {
+                break;
+            }
+
+            size_t end = std::min(m_asicKeys.size(), start + ASIC_STATE_SNAPSHOT_PARSE_CHUNK);
+
+            for (size_t idx = start; idx < end; idx++)
+            {
+                try
+                {
+                    auto objectType = getObjectTypeFromAsicKey(m_asicKeys[idx]);
+
+                    lists[idx] = std::make_shared<OtaiAttributeList>(objectType, values[idx], false);
+                }
+                catch (const std::exception& e)
+                {
+                    errors[idx] = e.what();
+                }
+            }
+        }
+    };
+
+    size_t chunks = (m_asicKeys.size() + ASIC_STATE_SNAPSHOT_PARSE_CHUNK - 1) / ASIC_STATE_SNAPSHOT_PARSE_CHUNK;
+
+    size_t threadCount = std::min<size_t>(
+            std::max(1u, std::thread::hardware_concurrency()),
+            ASIC_STATE_SNAPSHOT_MAX_THREADS);
+
+    threadCount = std::min(threadCount, chunks);
+
+    if (threadCount <= 1)
+    {
+        worker();
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+
+        for (size_t idx = 0; idx < threadCount; idx++)
+        {
+            threads.emplace_back(worker);
+        }
+
+        for (auto& t: threads)
+        {
+            t.join();
+        }
+    }
+
+    AttributesLists attributesLists;
+
+    attributesLists.reserve(m_asicKeys.size());
+
+    for (size_t idx = 0; idx < m_asicKeys.size(); idx++)
+    {
+        // report first failed key in key order, regardless of thread timing
+
+        if (errors[idx].size())
+        {
+            SWSS_LOG_THROW("failed to parse asic key %s: %s",
+                    m_asicKeys[idx].c_str(),
+                    errors[idx].c_str());
+        }
+
+        attributesLists[m_asicKeys[idx]] = lists[idx];
+    }
+
+    return attributesLists;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "RedisClient.h"
+
+#include "meta/OtaiAttributeList.h"
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+
+namespace syncd
+{
+    /**
+     * @brief ASIC state snapshot used by reinit.
+     *
+     * Attributes of all given ASIC keys are fetched using pipelined HGETALL
+     * and deserialized into attribute lists by multiple threads, reiniters
+     * then use attribute lists directly instead of querying redis per object.
+     */
+    class AsicStateSnapshot
+    {
+        public:
+
+            typedef std::unordered_map<std::string, std::shared_ptr<otaimeta::OtaiAttributeList>> AttributesLists;
+
+        public:
+
+            AsicStateSnapshot(
+                    _In_ std::shared_ptr<RedisClient> client,
+                    _In_ const std::vector<std::string>& asicKeys);
+
+            virtual ~AsicStateSnapshot() = default;
+
+        public:
+
+            /**
+             * @brief Load snapshot from redis.
+             *
+             * Throws when any key has invalid object type or attributes.
+             */
+            AttributesLists load();
+
+        public:
+
+            static otai_object_type_t getObjectTypeFromAsicKey(
+                    _In_ const std::string& key);
+
+        private:
+
+            std::shared_ptr<RedisClient> m_client;
+
+            std::vector<std::string> m_asicKeys;
+    };
+}
@@ -0,0 +1,101 @@
+#include "BinaryPacking.h"
+
+#include "swss/logger.h"
+
+#include <string.h>
+
+using namespace syncd;
+
+void BinaryPacking::packUint32(
+        _Inout_ std::string& data,
+        _In_ uint32_t value)
+{
+    SWSS_LOG_ENTER();
+
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        data.push_back((char)((value >> shift) & 0xff));
+    }
+}
+
+void BinaryPacking::packUint64(
+        _Inout_ std::string& data,
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    for (int shift = 0; shift < 64; shift += 8)
+    {
+        data.push_back((char)((value >> shift) & 0xff));
+    }
+}
+
+void BinaryPacking::packDouble(
+        _Inout_ std::string& data,
+        _In_ double value)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+
+    packUint64(data, bits);
+}
+
+uint32_t BinaryPacking::unpackUint32(
+        _In_ const std::string& data,
+        _In_ size_t offset)
+{
+    SWSS_LOG_ENTER();
+
+    if (offset + sizeof(uint32_t) > data.size())
+    {
+        SWSS_LOG_THROW("offset %zu out of packed data size %zu", offset, data.size());
+    }
+
+    uint32_t value = 0;
+
+    for (size_t idx = 0; idx < sizeof(uint32_t); idx++)
+    {
+        value |= (uint32_t)(uint8_t)data[offset + idx] << (8 * idx);
+    }
+
+    return value;
+}
+
+uint64_t BinaryPacking::unpackUint64(
+        _In_ const std::string& data,
+        _In_ size_t offset)
+{
+    SWSS_LOG_ENTER();
+
+    if (offset + sizeof(uint64_t) > data.size())
+    {
+        SWSS_LOG_THROW("offset %zu out of packed data size %zu", offset, data.size());
+    }
+
+    uint64_t value = 0;
+
+    for (size_t idx = 0; idx < sizeof(uint64_t); idx++)
+    {
+        value |= (uint64_t)(uint8_t)data[offset + idx] << (8 * idx);
+    }
+
+    return value;
+}
+
+double BinaryPacking::unpackDouble(
+        _In_ const std::string& data,
+        _In_ size_t offset)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t bits = unpackUint64(data, offset);
+
+    double value;
+
+    memcpy(&value, &bits, sizeof(value));
+
+    return value;
+}
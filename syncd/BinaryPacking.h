@@ -0,0 +1,50 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <string>
+#include <stdint.h>
+
+namespace syncd
+{
+    /**
+     * @brief Little endian packing of fixed size values.
+     *
+     * Used by compact STATE DB and HISTORY DB encodings, so stored data
+     * doesn't depend on syncd host byte order.
+     */
+    class BinaryPacking
+    {
+        private:
+
+            BinaryPacking() = delete;
+
+            ~BinaryPacking() = delete;
+
+        public:
+
+            static void packUint32(
+                    _Inout_ std::string& data,
+                    _In_ uint32_t value);
+
+            static void packUint64(
+                    _Inout_ std::string& data,
+                    _In_ uint64_t value);
+
+            static void packDouble(
+                    _Inout_ std::string& data,
+                    _In_ double value);
+
+            static uint32_t unpackUint32(
+                    _In_ const std::string& data,
+                    _In_ size_t offset);
+
+            static uint64_t unpackUint64(
+                    _In_ const std::string& data,
+                    _In_ size_t offset);
+
+            static double unpackDouble(
+                    _In_ const std::string& data,
+                    _In_ size_t offset);
+    };
+}
@@ -1,4 +1,5 @@
 #include "CommandLineOptions.h"
+#include "OtdrTrace.h"
 
 #include "meta/otai_serialize.h"
 
@@ -20,6 +21,24 @@ CommandLineOptions::CommandLineOptions()
 
     m_profileMapFile = "";
 
+    m_reinitConcurrency = 1;
+
+    m_softReinitDiffOnly = false;
+
+    m_warmBoot = false;
+
+    m_journalDirectory = "";
+
+    m_ocmCompactEncoding = false;
+
+    m_otdrTraceEncoding = OTDR_TRACE_ENCODING_TEXT;
+
+    m_alarmDampingConfig = "";
+
+    m_contextConfig = "";
+
+    m_globalContext = 0;
+
 }
 
 std::string CommandLineOptions::getCommandLineString() const
@@ -30,6 +49,15 @@ std::string CommandLineOptions::getCommandLineString() const
 
     ss << " EnableOtaiBulkSuport=" << (m_enableOtaiBulkSupport ? "YES" : "NO");
     ss << " ProfileMapFile=" << m_profileMapFile;
+    ss << " ReinitConcurrency=" << m_reinitConcurrency;
+    ss << " SoftReinitDiffOnly=" << (m_softReinitDiffOnly ? "YES" : "NO");
+    ss << " WarmBoot=" << (m_warmBoot ? "YES" : "NO");
+    ss << " JournalDirectory=" << m_journalDirectory;
+    ss << " OcmCompactEncoding=" << (m_ocmCompactEncoding ? "YES" : "NO");
+    ss << " OtdrTraceEncoding=" << m_otdrTraceEncoding;
+    ss << " AlarmDampingConfig=" << m_alarmDampingConfig;
+    ss << " ContextConfig=" << m_contextConfig;
+    ss << " GlobalContext=" << m_globalContext;
 
     return ss.str();
 }
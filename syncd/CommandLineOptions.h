@@ -25,6 +25,63 @@ namespace syncd
 
             std::string m_profileMapFile;
 
+            /**
+             * @brief Number of objects created concurrently on hard reinit.
+             *
+             * Values above 1 require thread safe vendor OTAI library, since
+             * vendor API calls are not serialized by syncd while objects are
+             * created concurrently.
+             */
+            uint32_t m_reinitConcurrency;
+
+            /**
+             * @brief On soft reinit set only attributes which differ from
+             * current hardware values.
+             */
+            bool m_softReinitDiffOnly;
+
+            /**
+             * @brief On start reuse hardware state left by previous syncd
+             * instance instead of recreating all objects, and keep hardware
+             * programmed on shutdown.
+             */
+            bool m_warmBoot;
+
+            /**
+             * @brief Directory for ASIC DB operation journal and snapshot,
+             * journal is disabled when empty.
+             */
+            std::string m_journalDirectory;
+
+            /**
+             * @brief Store OCM spectrum scan as single packed value instead
+             * of key per channel.
+             */
+            bool m_ocmCompactEncoding;
+
+            /**
+             * @brief Encoding of stored OTDR traces, "text", "raw" or "zstd".
+             */
+            std::string m_otdrTraceEncoding;
+
+            /**
+             * @brief Alarm damping configuration file, see AlarmDamping,
+             * damping is disabled when empty.
+             */
+            std::string m_alarmDampingConfig;
+
+            /**
+             * @brief Context config file, see ContextConfigContainer, default
+             * context is used when empty.
+             */
+            std::string m_contextConfig;
+
+            /**
+             * @brief Guid of context handled by this syncd instance, selects
+             * databases used by syncd.
+             */
+            uint32_t m_globalContext;
+
 			uint32_t m_loglevel;
     };
 }
@@ -1,4 +1,5 @@
 #include "CommandLineOptionsParser.h"
+#include "OtdrTrace.h"
 
 #include "meta/otai_serialize.h"
 
@@ -7,6 +8,7 @@
 #include <getopt.h>
 
 #include <iostream>
+#include <cstdlib>
 
 using namespace syncd;
 
@@ -17,7 +19,7 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
     SWSS_LOG_ENTER();
 
     auto options = std::make_shared<CommandLineOptions>();
-    const char* const optstring = "p:f:lh";
+    const char* const optstring = "p:f:lj:dwJ:ct:a:x:g:h";
 
     while (true)
     {
@@ -25,6 +27,15 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
         {
             { "profile",                 required_argument, 0, 'p' },
             { "enableOtaiBulkSupport",    no_argument,       0, 'l' },
+            { "reinitConcurrency",       required_argument, 0, 'j' },
+            { "softReinitDiffOnly",      no_argument,       0, 'd' },
+            { "warmBoot",                no_argument,       0, 'w' },
+            { "journalDirectory",        required_argument, 0, 'J' },
+            { "ocmCompactEncoding",      no_argument,       0, 'c' },
+            { "otdrTraceEncoding",       required_argument, 0, 't' },
+            { "alarmDampingConfig",      required_argument, 0, 'a' },
+            { "contextConfig",           required_argument, 0, 'x' },
+            { "globalContext",           required_argument, 0, 'g' },
             { "help",                    no_argument,       0, 'h' },
             { 0,                         0,                 0,  0  }
         };
@@ -48,6 +59,71 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
                 options->m_enableOtaiBulkSupport = true;
                 break;
 
+            case 'j':
+                {
+                    int concurrency = std::atoi(optarg);
+
+                    if (concurrency < 1)
+                    {
+                        SWSS_LOG_ERROR("invalid reinit concurrency %s", optarg);
+                        printUsage();
+                        exit(EXIT_FAILURE);
+                    }
+
+                    options->m_reinitConcurrency = (uint32_t)concurrency;
+                }
+                break;
+
+            case 'd':
+                options->m_softReinitDiffOnly = true;
+                break;
+
+            case 'w':
+                options->m_warmBoot = true;
+                break;
+
+            case 'J':
+                options->m_journalDirectory = std::string(optarg);
+                break;
+
+            case 'c':
+                options->m_ocmCompactEncoding = true;
+                break;
+
+            case 't':
+                if (!OtdrTrace::isEncodingSupported(optarg))
+                {
+                    SWSS_LOG_ERROR("invalid OTDR trace encoding %s", optarg);
+                    printUsage();
+                    exit(EXIT_FAILURE);
+                }
+
+                options->m_otdrTraceEncoding = std::string(optarg);
+                break;
+
+            case 'a':
+                options->m_alarmDampingConfig = std::string(optarg);
+                break;
+
+            case 'x':
+                options->m_contextConfig = std::string(optarg);
+                break;
+
+            case 'g':
+                {
+                    int guid = std::atoi(optarg);
+
+                    if (guid < 0)
+                    {
+                        SWSS_LOG_ERROR("invalid global context %s", optarg);
+                        printUsage();
+                        exit(EXIT_FAILURE);
+                    }
+
+                    options->m_globalContext = (uint32_t)guid;
+                }
+                break;
+
             case 'h':
                 printUsage();
                 exit(EXIT_SUCCESS);
@@ -70,11 +146,30 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
 void CommandLineOptionsParser::printUsage()
 {
     SWSS_LOG_ENTER();
-    std::cout << "Usage: syncd [-p profile] [-l] [-h]" << std::endl;
+    std::cout << "Usage: syncd [-p profile] [-l] [-j concurrency] [-d] [-w] [-J directory] [-c] [-t encoding] [-a file] [-x file] [-g guid] [-h]" << std::endl;
     std::cout << "    -p --profile profile" << std::endl;
     std::cout << "        Provide profile map file" << std::endl;
     std::cout << "    -l --enableBulk" << std::endl;
     std::cout << "        Enable OTAI Bulk support" << std::endl;
+    std::cout << "    -j --reinitConcurrency concurrency" << std::endl;
+    std::cout << "        Number of objects created concurrently on hard reinit, default 1," << std::endl;
+    std::cout << "        values above 1 require thread safe vendor OTAI library" << std::endl;
+    std::cout << "    -d --softReinitDiffOnly" << std::endl;
+    std::cout << "        On soft reinit set only attributes which differ from hardware" << std::endl;
+    std::cout << "    -w --warmBoot" << std::endl;
+    std::cout << "        Reuse hardware state on start and keep it on shutdown" << std::endl;
+    std::cout << "    -J --journalDirectory directory" << std::endl;
+    std::cout << "        Journal applied ASIC DB operations to given directory" << std::endl;
+    std::cout << "    -c --ocmCompactEncoding" << std::endl;
+    std::cout << "        Store OCM spectrum as single packed value per scan" << std::endl;
+    std::cout << "    -t --otdrTraceEncoding encoding" << std::endl;
+    std::cout << "        Encoding of stored OTDR traces, text, raw or zstd, default text" << std::endl;
+    std::cout << "    -a --alarmDampingConfig file" << std::endl;
+    std::cout << "        Alarm hold-down, flap and rate limit configuration (json)" << std::endl;
+    std::cout << "    -x --contextConfig file" << std::endl;
+    std::cout << "        Context configuration file (json)" << std::endl;
+    std::cout << "    -g --globalContext guid" << std::endl;
+    std::cout << "        Guid of context from context configuration, default 0" << std::endl;
     std::cout << "    -h --help" << std::endl;
     std::cout << "        Print out this message" << std::endl;
 }
@@ -2,6 +2,9 @@
 #include <chrono>
 #include <cstdio>
 #include <cstdlib>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 
 #include "FlexCounter.h"
 #include "VidManager.h"
@@ -17,13 +20,19 @@ using namespace syncd;
 #define MUTEX std::unique_lock<std::mutex> _lock(m_mtx);
 #define MUTEX_UNLOCK _lock.unlock();
 
+/*
+ * Maximum number of threads constructing collectors in addCounters.
+ */
+#define FLEX_COUNTER_BUILD_THREADS 8
+
 FlexCounter::FlexCounter(
     _In_ const std::string& instanceId,
     _In_ std::shared_ptr<otairedis::OtaiInterface> vendorOtai,
-    _In_ const std::string& dbCounters):
+    _In_ std::shared_ptr<otairedis::ContextConfig> contextConfig):
     m_pollInterval(0),
     m_instanceId(instanceId),
-    m_vendorOtai(vendorOtai)
+    m_vendorOtai(vendorOtai),
+    m_contextConfig(contextConfig)
 {
     SWSS_LOG_ENTER();
 
@@ -320,17 +329,17 @@ void FlexCounter::removeCounter(
     }
 }
 
-void FlexCounter::addCounter(
+Collector* FlexCounter::createCollector(
     _In_ otai_object_id_t vid,
     _In_ otai_object_id_t rid,
     _In_ const std::vector<swss::FieldValueTuple>& values)
 {
-    MUTEX;
-
     SWSS_LOG_ENTER();
 
     otai_object_type_t objectType = VidManager::objectTypeQuery(vid); // VID and RID will have the same object type
 
+    Collector *c = NULL;
+
     for (const auto& valuePair : values)
     {
         const auto field = fvField(valuePair);
@@ -342,29 +351,147 @@ void FlexCounter::addCounter(
 
         SWSS_LOG_NOTICE("Object type %s rid 0x%" PRIx64 " m_propGroup %d",
                         otai_serialize_object_type(objectType).c_str(), rid, (int)m_propGroup);
-        
-        Collector *c = NULL;
+
+        Collector *n = NULL;
 
         if (m_propGroup == OTAI_PROPERTY_GROUP_ATTR)
         {
-            c = new OtaiAttrCollector(objectType, vid, rid, m_vendorOtai, counterIds);
+            n = new OtaiAttrCollector(objectType, vid, rid, m_vendorOtai, m_contextConfig, counterIds);
         }
         else if (m_propGroup == OTAI_PROPERTY_GROUP_STAT)
         {
-            c = new OtaiStatCollector(objectType, vid, rid, m_vendorOtai, counterIds);
+            n = new OtaiStatCollector(objectType, vid, rid, m_vendorOtai, m_contextConfig, counterIds);
         }
         else if (m_propGroup == OTAI_PROPERTY_GROUP_GAUGE)
         {
-            c = new OtaiGaugeCollector(objectType, vid, rid, m_vendorOtai, counterIds);
+            n = new OtaiGaugeCollector(objectType, vid, rid, m_vendorOtai, m_contextConfig, counterIds);
         }
 
-        if (c != NULL)
+        if (n != NULL)
         {
-            m_collectors[vid] = c;
+            delete c;
+            c = n;
         }
     }
 
+    return c;
+}
+
+void FlexCounter::installCollector(
+    _In_ otai_object_id_t vid,
+    _In_ Collector* collector)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_collectors.find(vid);
+
+    if (it != m_collectors.end())
+    {
+        delete it->second;
+    }
+
+    m_collectors[vid] = collector;
+}
+
+void FlexCounter::addCounter(
+    _In_ otai_object_id_t vid,
+    _In_ otai_object_id_t rid,
+    _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    // collector constructor talks to vendor and databases, don't block
+    // polling thread while it runs
+
+    Collector *c = createCollector(vid, rid, values);
+
+    MUTEX;
+
+    if (c != NULL)
+    {
+        installCollector(vid, c);
+    }
+
     // notify thread to start polling
     m_pollCond.notify_all();
 }
 
+void FlexCounter::addCounters(
+    _In_ const std::vector<FlexCounterEntry>& entries)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("add %zu counters to %s", entries.size(), m_instanceId.c_str());
+
+    std::vector<Collector*> collectors(entries.size(), NULL);
+
+    std::vector<std::string> errors(entries.size());
+
+    std::atomic<size_t> next(0);
+
+    auto worker = [&]()
+    {
+        for (size_t idx = next++; idx < entries.size(); idx = next++)
+        {
+            try
+            {
+                collectors[idx] = createCollector(entries[idx].m_vid, entries[idx].m_rid, entries[idx].m_values);
+            }
+            catch (const std::exception& e)
+            {
+                errors[idx] = e.what();
+            }
+        }
+    };
+
+    size_t threadCount = std::min<size_t>(FLEX_COUNTER_BUILD_THREADS, entries.size());
+
+    if (threadCount <= 1)
+    {
+        worker();
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+
+        for (size_t idx = 0; idx < threadCount; idx++)
+        {
+            threads.emplace_back(worker);
+        }
+
+        for (auto& t: threads)
+        {
+            t.join();
+        }
+    }
+
+    for (size_t idx = 0; idx < entries.size(); idx++)
+    {
+        if (errors[idx].empty())
+        {
+            continue;
+        }
+
+        for (auto c: collectors)
+        {
+            delete c;
+        }
+
+        SWSS_LOG_THROW("failed to create collector for VID %s: %s",
+                otai_serialize_object_id(entries[idx].m_vid).c_str(),
+                errors[idx].c_str());
+    }
+
+    MUTEX;
+
+    for (size_t idx = 0; idx < entries.size(); idx++)
+    {
+        if (collectors[idx] != NULL)
+        {
+            installCollector(entries[idx].m_vid, collectors[idx]);
+        }
+    }
+
+    // notify thread to start polling
+    m_pollCond.notify_all();
+}
@@ -34,6 +34,16 @@ namespace syncd
         OTAI_PROPERTY_GROUP_MAX,
     };
 
+    typedef struct _FlexCounterEntry
+    {
+        otai_object_id_t m_vid;
+
+        otai_object_id_t m_rid;
+
+        std::vector<swss::FieldValueTuple> m_values;
+
+    } FlexCounterEntry;
+
     class FlexCounter
     {
     private:
@@ -45,7 +55,7 @@ namespace syncd
         FlexCounter(
             _In_ const std::string& instanceId,
             _In_ std::shared_ptr<otairedis::OtaiInterface> vendorOtai,
-            _In_ const std::string& dbCounters);
+            _In_ std::shared_ptr<otairedis::ContextConfig> contextConfig);
 
         virtual ~FlexCounter();
 
@@ -61,6 +71,16 @@ namespace syncd
             _In_ otai_object_id_t rid,
             _In_ const std::vector<swss::FieldValueTuple>& values);
 
+        /**
+         * @brief Add multiple counters at once.
+         *
+         * Collectors are constructed in parallel without holding instance
+         * lock, so polling is not blocked, and then installed in single
+         * step. When any collector fails to construct, none is installed.
+         */
+        void addCounters(
+            _In_ const std::vector<FlexCounterEntry>& entries);
+
         void removeCounter(
             _In_ otai_object_id_t vid);
 
@@ -88,6 +108,15 @@ namespace syncd
 
         bool allPluginsEmpty() const;
 
+        Collector* createCollector(
+            _In_ otai_object_id_t vid,
+            _In_ otai_object_id_t rid,
+            _In_ const std::vector<swss::FieldValueTuple>& values);
+
+        void installCollector(
+            _In_ otai_object_id_t vid,
+            _In_ Collector* collector);
+
     private:
 
         void collectCounters();
@@ -142,6 +171,8 @@ namespace syncd
 
         std::shared_ptr<otairedis::OtaiInterface> m_vendorOtai;
 
+        std::shared_ptr<otairedis::ContextConfig> m_contextConfig;
+
         map<otai_object_id_t, Collector*> m_collectors;
 
         bool m_isDiscarded;
@@ -8,9 +8,9 @@ using namespace syncd;
 
 FlexCounterManager::FlexCounterManager(
     _In_ std::shared_ptr<otairedis::OtaiInterface> vendorOtai,
-    _In_ const std::string& dbCounters):
+    _In_ std::shared_ptr<otairedis::ContextConfig> contextConfig):
     m_vendorOtai(vendorOtai),
-    m_dbCounters(dbCounters)
+    m_contextConfig(contextConfig)
 {
     SWSS_LOG_ENTER();
 
@@ -26,7 +26,7 @@ std::shared_ptr<FlexCounter> FlexCounterManager::getInstance(
 
     if (m_flexCounters.count(instanceId) == 0)
     {
-        auto counter = std::make_shared<FlexCounter>(instanceId, m_vendorOtai, m_dbCounters);
+        auto counter = std::make_shared<FlexCounter>(instanceId, m_vendorOtai, m_contextConfig);
 
         m_flexCounters[instanceId] = counter;
     }
@@ -97,6 +97,22 @@ void FlexCounterManager::addCounter(
     }
 }
 
+void FlexCounterManager::addCounters(
+    _In_ const std::string& instanceId,
+    _In_ const std::vector<FlexCounterEntry>& entries)
+{
+    SWSS_LOG_ENTER();
+
+    auto fc = getInstance(instanceId);
+
+    fc->addCounters(entries);
+
+    if (fc->isDiscarded())
+    {
+        removeInstance(instanceId);
+    }
+}
+
 void FlexCounterManager::removeCounter(
     _In_ otai_object_id_t vid,
     _In_ const std::string& instanceId)
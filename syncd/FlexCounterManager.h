@@ -10,7 +10,7 @@ namespace syncd
 
         FlexCounterManager(
             _In_ std::shared_ptr<otairedis::OtaiInterface> vendorOtai,
-            _In_ const std::string& dbCounters);
+            _In_ std::shared_ptr<otairedis::ContextConfig> contextConfig);
 
         virtual ~FlexCounterManager() = default;
 
@@ -37,6 +37,13 @@ namespace syncd
             _In_ const std::string& instanceId,
             _In_ const std::vector<swss::FieldValueTuple>& values);
 
+        /**
+         * @brief Add multiple counters to single instance at once.
+         */
+        void addCounters(
+            _In_ const std::string& instanceId,
+            _In_ const std::vector<FlexCounterEntry>& entries);
+
         void removeCounter(
             _In_ otai_object_id_t vid,
             _In_ const std::string& instanceId);
@@ -49,9 +56,7 @@ namespace syncd
 
         std::shared_ptr<otairedis::OtaiInterface> m_vendorOtai;
 
-        std::string m_dbCounters;
-        std::string m_dbState;
-        std::string m_dbGBCounters;
+        std::shared_ptr<otairedis::ContextConfig> m_contextConfig;
     };
 }
 
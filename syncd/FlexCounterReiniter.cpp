@@ -72,38 +72,35 @@ void FlexCounterReiniter::prepareFlexCounterState()
     SWSS_LOG_ENTER();
 
     SWSS_LOG_TIMER("read flexCounter state");
-    for (auto& key : m_flexCounterKeys)
-    {
-        otai_object_id_t rid;
-        otai_object_id_t vid;
-        std::string instancdID;
-        m_values = redisGetAttributesFromKey(key);
-        getInfoFromFlexCounterKey(key, instancdID, vid, rid);
-        SWSS_LOG_NOTICE("key is %s vid is 0x%" PRIx64 " rid is 0x%" PRIx64 " instanceID is %s", key.c_str(), vid, rid, instancdID.c_str());
-        m_manager->addCounter(vid, rid, instancdID, m_values);
-    }
-}
 
-std::vector<swss::FieldValueTuple> FlexCounterReiniter::redisGetAttributesFromKey(
-    _In_ const std::string& key)
-{
-    SWSS_LOG_ENTER();
+    auto values = m_client->getAttributesFromFlexCounterKeys(m_flexCounterKeys);
 
-    std::vector<swss::FieldValueTuple> values;
+    // counters are grouped per instance, so each instance installs all its
+    // collectors at once
 
-    auto hash = m_client->getAttributesFromFlexCounterKey(key);
+    std::map<std::string, std::vector<FlexCounterEntry>> groups;
 
-    for (auto& kv : hash)
+    for (size_t idx = 0; idx < m_flexCounterKeys.size(); idx++)
     {
-        const std::string& skey = kv.first;
-        const std::string& svalue = kv.second;
-        SWSS_LOG_DEBUG("redisGetAttributesFromKey skey is %s svalue is %s", skey.c_str(), svalue.c_str());
-        swss::FieldValueTuple fvt(skey, svalue);
+        otai_object_id_t rid = OTAI_NULL_OBJECT_ID;
+        otai_object_id_t vid = OTAI_NULL_OBJECT_ID;
+        std::string instancdID;
+        getInfoFromFlexCounterKey(m_flexCounterKeys[idx], instancdID, vid, rid);
+        SWSS_LOG_NOTICE("key is %s vid is 0x%" PRIx64 " rid is 0x%" PRIx64 " instanceID is %s", m_flexCounterKeys[idx].c_str(), vid, rid, instancdID.c_str());
 
-        values.push_back(fvt);
+        FlexCounterEntry entry;
+
+        entry.m_vid = vid;
+        entry.m_rid = rid;
+        entry.m_values = std::move(values[idx]);
+
+        groups[instancdID].push_back(std::move(entry));
     }
 
-    return values;
+    for (auto& group : groups)
+    {
+        m_manager->addCounters(group.first, group.second);
+    }
 }
 
 void FlexCounterReiniter::hardReinit()
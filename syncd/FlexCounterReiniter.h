@@ -36,7 +36,6 @@ namespace syncd
     private:
         void prepareFlexCounterState();
         void getInfoFromFlexCounterKey(_In_ const std::string& key, _Out_ std::string& instancdID, _Out_ otai_object_id_t& vid, _Out_ otai_object_id_t& rid);
-        std::vector<swss::FieldValueTuple> redisGetAttributesFromKey(_In_ const std::string& key);
     public:
         void hardReinit();
     private:
@@ -48,7 +47,6 @@ namespace syncd
         std::vector<std::string> m_flexCounterKeys;
         otai_object_id_t m_linecard_rid;
         otai_object_id_t m_linecard_vid;
-        std::vector<swss::FieldValueTuple> m_values;
     };
 
     class FlexCounterGroupReiniter
@@ -15,12 +15,16 @@ HardReiniter::HardReiniter(
         _In_ std::shared_ptr<VirtualOidTranslator> translator,
         _In_ std::shared_ptr<otairedis::OtaiInterface> otai,
         _In_ std::shared_ptr<NotificationHandler> handler,
-        _In_ std::shared_ptr<FlexCounterManager> manager):
+        _In_ std::shared_ptr<FlexCounterManager> manager,
+        _In_ const std::string& dbState,
+        _In_ uint32_t concurrency):
     m_vendorOtai(otai),
     m_translator(translator),
     m_client(client),
     m_handler(handler),
-    m_manager(manager)
+    m_manager(manager),
+    m_dbState(dbState),
+    m_concurrency(concurrency)
 {
     SWSS_LOG_ENTER();
 
@@ -43,12 +47,40 @@ void HardReiniter::readAsicState()
     m_vidToRidMap = m_client->getVidToRidMap();
     m_ridToVidMap = m_client->getRidToVidMap();
     m_linecardKeys = m_client->getAsicStateKeys();
+
+    // maps were just read, so translator doesn't need to reach redis again
+    m_translator->preload(m_vidToRidMap, m_ridToVidMap);
 }
 
 std::shared_ptr<syncd::OtaiLinecard> HardReiniter::hardReinit()
 {
     SWSS_LOG_ENTER();
 
+    auto statistics = std::make_shared<ReinitStatistics>("HARD", m_dbState);
+
+    try
+    {
+        auto linecard = hardReinit(statistics);
+
+        statistics->finish(true);
+
+        return linecard;
+    }
+    catch (const std::exception&)
+    {
+        statistics->finish(false);
+
+        throw;
+    }
+}
+
+std::shared_ptr<syncd::OtaiLinecard> HardReiniter::hardReinit(
+        _In_ std::shared_ptr<ReinitStatistics> statistics)
+{
+    SWSS_LOG_ENTER();
+
+    statistics->startPhase("read-maps");
+
     readAsicState();
     
     // perform reinit on the linecard
@@ -59,10 +91,31 @@ std::shared_ptr<syncd::OtaiLinecard> HardReiniter::hardReinit()
             m_handler,
             m_vidToRidMap,
             m_ridToVidMap,
-            m_linecardKeys);
+            m_linecardKeys,
+            m_concurrency,
+            statistics);
     sr->hardReinit();
 
+    // RIDs can be different after reinit, translated map replaces previous
+    // one, both in redis and in translator
+
+    statistics->startPhase("translation-store");
+
+    auto vidToRid = sr->getTranslatedVid2Rid();
+
+    ObjectIdMap ridToVid;
+
+    for (auto& v2r: vidToRid)
+    {
+        ridToVid[v2r.second] = v2r.first;
+    }
+
+    m_client->setVidAndRidMap(vidToRid);
+    m_translator->preload(vidToRid, ridToVid);
+
     // perform reinit on the flexcounter groups
+    statistics->startPhase("flex-counter-group-restore");
+
     auto flexCounterGroupKeys = m_client->getFlexCounterGroupKeys();    
     auto fgr = std::make_shared<FlexCounterGroupReiniter>(
                 m_client,
@@ -71,6 +124,8 @@ std::shared_ptr<syncd::OtaiLinecard> HardReiniter::hardReinit()
     fgr->hardReinit();
 
     // perform reinit on the flexcounters
+    statistics->startPhase("flex-counter-restore");
+
     auto flexCounterKeys = m_client->getFlexCounterKeys();
     auto fr = std::make_shared<FlexCounterReiniter>(
             m_client,
@@ -6,6 +6,7 @@
 #include "RedisClient.h"
 #include "NotificationHandler.h"
 #include "FlexCounterManager.h"
+#include "ReinitStatistics.h"
 
 #include <string>
 #include <unordered_map>
@@ -29,7 +30,9 @@ namespace syncd
                     _In_ std::shared_ptr<VirtualOidTranslator> translator,
                     _In_ std::shared_ptr<otairedis::OtaiInterface> otai,
                     _In_ std::shared_ptr<NotificationHandler> handler,
-                    _In_ std::shared_ptr<FlexCounterManager> manager);
+                    _In_ std::shared_ptr<FlexCounterManager> manager,
+                    _In_ const std::string& dbState,
+                    _In_ uint32_t concurrency);
 
             virtual ~HardReiniter();
 
@@ -39,6 +42,9 @@ namespace syncd
 
         private:
 
+            std::shared_ptr<syncd::OtaiLinecard> hardReinit(
+                    _In_ std::shared_ptr<ReinitStatistics> statistics);
+
             void readAsicState();
 
         private:
@@ -57,5 +63,9 @@ namespace syncd
             std::shared_ptr<NotificationHandler> m_handler;
 
             std::shared_ptr<FlexCounterManager> m_manager;
+
+            std::string m_dbState;
+
+            uint32_t m_concurrency;
     };
 }
@@ -1,5 +1,6 @@
 #include "NotificationHandler.h"
 #include "otairediscommon.h"
+#include "OtdrTrace.h"
 
 #include "swss/logger.h"
 #include "nlohmann/json.hpp"
@@ -13,15 +14,15 @@ using namespace std;
 using namespace swss;
 
 NotificationHandler::NotificationHandler(
-    _In_ std::shared_ptr<NotificationProcessor> processor) :
+    _In_ std::shared_ptr<NotificationProcessor> processor,
+    _In_ const std::string& dbState) :
     m_processor(processor)
 {
     SWSS_LOG_ENTER();
 
     memset(&m_notifications, 0, sizeof(m_notifications));
-    m_state_db = std::shared_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
+    m_state_db = std::shared_ptr<DBConnector>(new DBConnector(dbState, 0));
     m_linecardtable = std::unique_ptr<Table>(new Table(m_state_db.get(), "LINECARD"));
-    m_curalarmtable = std::unique_ptr<Table>(new Table(m_state_db.get(), "CURALARM"));
     m_notificationQueue = processor->getQueue();
 }
 
@@ -146,13 +147,19 @@ void NotificationHandler::onOtdrReportResult(
 
     j["span-distance"] = otai_serialize_decimal(result.events.span_distance);
     j["span-loss"] = otai_serialize_decimal(result.events.span_loss);
-    j["events"] = otai_serialize_otdr_event_list(result.events.events);
 
     j["update-time"] = otai_serialize_number(result.trace.update_time);
-    j["data"] = otai_serialize_hex_binary(result.trace.data.list, result.trace.data.count);
+
+    // trace and events are passed as binary, notification is processed in
+    // syncd only, so there is no need to serialize them as text
+
+    std::vector<swss::FieldValueTuple> fv;
+
+    fv.emplace_back(OTDR_FIELD_DATA, std::string((const char*)result.trace.data.list, result.trace.data.count));
+    fv.emplace_back(OTDR_FIELD_EVENTS, OtdrTrace::packEvents(result.events.events));
 
     std::string s = j.dump();
-    enqueueNotification(OTAI_OTDR_NOTIFICATION_NAME_RESULT_NOTIFY, s);
+    enqueueNotification(OTAI_OTDR_NOTIFICATION_NAME_RESULT_NOTIFY, s, fv);
 }
 
 void NotificationHandler::updateNotificationsPointers(
@@ -268,6 +275,15 @@ void NotificationHandler::generate_linecard_communication_alarm(
 
     std::vector<std::string> linecardkey;
     m_linecardtable->getKeys(linecardkey);
+
+    if (linecard_oper_status == OTAI_OPER_STATUS_INACTIVE)
+    {
+        // current alarms are owned by processing thread, alarms of this
+        // linecard are flushed there before communication alarms are raised
+
+        enqueueNotification(NOTIFICATION_QUEUE_CURRENT_ALARMS_FLUSH, otai_serialize_object_id(linecard_rid));
+    }
+
     for (const auto& strlinecard : linecardkey)
     {
         nlohmann::json j;
@@ -289,9 +305,6 @@ void NotificationHandler::generate_linecard_communication_alarm(
         {
             status = OTAI_ALARM_STATUS_ACTIVE;
             m_linecardtable->hset(strlinecard, "slot-status", "CommFail");
-
-            //flush all current alarms
-            m_curalarmtable->flush();
         }
         else
         {
@@ -352,10 +365,9 @@ void NotificationHandler::enqueueNotification(
 
     swss::KeyOpFieldsValuesTuple item(op, data, entry);
 
-    if (m_notificationQueue->enqueue(item))
-    {
-        m_processor->signal();
-    }
+    // queue wakes up processing thread itself, only when it is waiting
+
+    m_notificationQueue->enqueue(item);
 }
 
 void NotificationHandler::enqueueNotification(
@@ -22,7 +22,8 @@ namespace syncd
     public:
 
         NotificationHandler(
-            _In_ std::shared_ptr<NotificationProcessor> processor);
+            _In_ std::shared_ptr<NotificationProcessor> processor,
+            _In_ const std::string& dbState);
 
         virtual ~NotificationHandler();
 
@@ -84,8 +85,6 @@ namespace syncd
 
         std::unique_ptr<swss::Table> m_linecardtable;
 
-        std::unique_ptr<swss::Table> m_curalarmtable;
-
         otai_notifications_t m_notifications;
 
         std::shared_ptr<NotificationQueue> m_notificationQueue;
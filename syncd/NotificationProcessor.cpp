@@ -1,14 +1,19 @@
 #include "NotificationProcessor.h"
 #include "RedisClient.h"
+#include "OcmSpectrum.h"
+#include "OtdrTrace.h"
 
 #include "meta/otai_serialize.h"
 #include "meta/OtaiAttributeList.h"
 
 #include "swss/logger.h"
 #include "swss/notificationproducer.h"
+#include "swss/rediscommand.h"
+#include "swss/redisreply.h"
 
 #include "nlohmann/json.hpp"
 #include <inttypes.h>
+#include <algorithm>
 
 using json = nlohmann::json;
 using namespace syncd;
@@ -18,9 +23,100 @@ using namespace swss;
 #define EXIPRE_TIME_SECONDS_2DAYS (2 * 24 * 3600)
 #define EXIPRE_TIME_SECONDS_7DAYS (7 * 24 * 3600)
 
+#define OCM_SPECTRUM_TTL_SECONDS 60
+
+/*
+ * STATE DB table and key with notification queue statistics.
+ */
+#define SYNCD_NOTIFICATION_QUEUE_TABLE "SYNCD_NOTIFICATION_QUEUE"
+#define SYNCD_NOTIFICATION_QUEUE_KEY   "STATISTICS"
+
+#define NOTIFICATION_WAIT_TIMEOUT_MS 1000
+
+/*
+ * Internal notification processed when alarm damping deadline passed, so
+ * held alarms are applied under same synchronization as notifications.
+ */
+#define ALARM_DAMPING_TIMER_NOTIFICATION "alarm_damping_timer"
+
+/*
+ * Notifications are dequeued in batches, so policies are applied to all
+ * notifications which arrived in meantime before next batch.
+ */
+#define NOTIFICATION_DEQUEUE_BATCH_SIZE 64
+
+/*
+ * Number of newest scans kept in history per OTDR.
+ */
+#define OTDR_HISTORY_SCAN_COUNT 10
+
+/*
+ * History OTDR key is "OTDR:<name>|<scan-time>" and event key is
+ * "OTDR_EVENT:<name>|<scan-time>|<index>", bucket is everything between table
+ * name and last key element.
+ */
+static std::string getOtdrKeyBucket(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    auto start = key.find_first_of(":");
+    auto end = key.find_last_of("|");
+
+    if (start == std::string::npos || end == std::string::npos || end <= start)
+    {
+        return key;
+    }
+
+    return key.substr(start + 1, end - start - 1);
+}
+
+/*
+ * Alarm notification carries RID of linecard which raised it.
+ */
+static otai_object_id_t getAlarmLinecard(
+        _In_ const json& j)
+{
+    SWSS_LOG_ENTER();
+
+    otai_object_id_t linecard = OTAI_NULL_OBJECT_ID;
+
+    if (j.find("linecard_id") != j.end())
+    {
+        otai_deserialize_object_id(j["linecard_id"], linecard);
+    }
+
+    return linecard;
+}
+
+/*
+ * History OTDR keys are time indexed per OTDR name by scan time.
+ */
+static bool parseOtdrKey(
+        _In_ const std::string& key,
+        _Out_ std::string& name,
+        _Out_ uint64_t& scanTime)
+{
+    SWSS_LOG_ENTER();
+
+    auto delimiter = key.find_last_of("|");
+
+    if (delimiter == std::string::npos)
+    {
+        return false;
+    }
+
+    name = getOtdrKeyBucket(key);
+
+    otai_deserialize_number(key.substr(delimiter + 1), scanTime);
+
+    return true;
+}
+
 NotificationProcessor::NotificationProcessor(
     _In_ std::shared_ptr<NotificationProducerBase> producer,
     _In_ std::shared_ptr<RedisClient> client,
+    _In_ std::shared_ptr<otairedis::ContextConfig> contextConfig,
     _In_ std::function<void(const swss::KeyOpFieldsValuesTuple&)> synchronizer) :
     m_synchronizer(synchronizer),
     m_client(client),
@@ -30,23 +126,51 @@ NotificationProcessor::NotificationProcessor(
 
     m_runThread = false;
 
+    m_ocmCompactEncoding = false;
+
+    m_otdrTraceEncoding = OTDR_TRACE_ENCODING_TEXT;
+
     m_notificationQueue = std::make_shared<NotificationQueue>();
-    m_state_db = std::shared_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
+
+    // connections are kept for processor lifetime, so notification handling
+    // doesn't connect to redis
+
+    m_counters_db = std::make_shared<DBConnector>(contextConfig->m_dbCounters, 0);
+    m_asic_db = std::make_shared<DBConnector>(contextConfig->m_dbAsic, 0);
+    m_linecardStateProducer = std::make_shared<NotificationProducer>(m_asic_db.get(), SYNCD_NOTIFICATION_CHANNEL_LINECARDSTATE);
+
+    m_state_db = std::shared_ptr<DBConnector>(new DBConnector(contextConfig->m_dbState, 0));
     m_stateAlarmable = std::unique_ptr<Table>(new Table(m_state_db.get(), "CURALARM"));
+
+    loadCurrentAlarms();
+
+    m_alarmDamping = std::make_shared<AlarmDamping>();
+
+    m_stateAlarmDampingTable = std::unique_ptr<Table>(new Table(m_state_db.get(), ALARM_DAMPING_TABLE));
     m_stateOLPSwitchInfoTbl = std::unique_ptr<Table>(new Table(m_state_db.get(), "OLP_SWITCH_INFO"));
     m_stateOcmTable = std::unique_ptr<Table>(new Table(m_state_db.get(), STATE_OT_OCM_TABLE_NAME));
 
     m_stateOtdrTable = std::make_shared<Table>(m_state_db.get(), STATE_OT_OTDR_TABLE_NAME);
     m_stateOtdrEventTable = std::make_shared<Table>(m_state_db.get(), "OTDR_EVENT");
 
-    m_history_db = std::shared_ptr<DBConnector>(new DBConnector(HISTORY_DB_NAME, 0));
+    m_stateNotificationQueueTable = std::unique_ptr<Table>(new Table(m_state_db.get(), SYNCD_NOTIFICATION_QUEUE_TABLE));
+
+    m_queueStatisticsVersion = 0;
+
+    m_history_db = std::shared_ptr<DBConnector>(new DBConnector(contextConfig->m_dbHistory, 0));
     m_historyAlarmTable = std::unique_ptr<Table>(new Table(m_history_db.get(), "HISALARM"));
     m_historyEventTable = std::unique_ptr<Table>(new Table(m_history_db.get(), "HISEVENT"));
 
     m_historyOtdrTable = std::make_shared<Table>(m_history_db.get(), "OTDR");
     m_historyOtdrEventTable = std::make_shared<Table>(m_history_db.get(), "OTDR_EVENT");
 
-    initOtdrScanTimeSet();
+    // history OTDR keys are indexed in sorted set per OTDR name by scan time,
+    // so retention doesn't depend on number of stored scans and nothing is
+    // loaded on start; event keys of text encoded scans are indexed per OTDR
+    // name and scan time
+
+    m_historyOtdrTimeIndex = std::make_shared<RedisTimeIndex>(m_history_db, "OTDR_TIME_INDEX", "OTDR:*", &parseOtdrKey);
+    m_historyOtdrEventIndex = std::make_shared<RedisKeyIndex>(m_history_db, "OTDR_EVENT_INDEX", "OTDR_EVENT:*", &getOtdrKeyBucket);
 
     m_ttlPM15Min = EXIPRE_TIME_SECONDS_2DAYS;
     m_ttlPM24Hour = EXIPRE_TIME_SECONDS_7DAYS;
@@ -60,41 +184,6 @@ NotificationProcessor::~NotificationProcessor()
     stopNotificationsProcessingThread();
 }
 
-void NotificationProcessor::initOtdrScanTimeSet()
-{
-    SWSS_LOG_ENTER();
-
-    std::map<std::string, std::set<uint64_t>> scanTimeSet;
-
-    std::string pattern = "OTDR:*";
-
-    auto keys = m_history_db->keys(pattern);
-
-    for (auto &k : keys)
-    {
-        auto name = m_history_db->hget(k, "name");
-        auto strScanTime = m_history_db->hget(k, "scan-time");
-
-        if (name == nullptr || strScanTime == nullptr)
-        {
-            continue;
-        }
-
-        uint64_t scanTime = 0;
-        otai_deserialize_number(*strScanTime, scanTime);
-
-        scanTimeSet[*name].insert(scanTime);
-    }
-
-    for (auto &s : scanTimeSet)
-    {
-        for (auto &t : s.second)
-        {
-            m_otdrScanTimeQueue[s.first].push(t);
-        }
-    }
-}
-
 void NotificationProcessor::sendNotification(
     _In_ const std::string& op,
     _In_ const std::string& data,
@@ -134,11 +223,8 @@ void NotificationProcessor::process_on_linecard_state_change(
 
     sendNotification(OTAI_LINECARD_NOTIFICATION_NAME_LINECARD_STATE_CHANGE, s);
 
-    swss::DBConnector db("ASIC_DB", 0);
-    swss::NotificationProducer linecard_state(&db, SYNCD_NOTIFICATION_CHANNEL_LINECARDSTATE);
-
     std::vector<swss::FieldValueTuple> values;
-    linecard_state.send(s, s, values);
+    m_linecardStateProducer->send(s, s, values);
 }
 
 void NotificationProcessor::handle_linecard_state_change(
@@ -172,15 +258,13 @@ void NotificationProcessor::handle_olp_switch_notify(
         SWSS_LOG_ERROR("translate rid to vid failed, rid=0x%" PRIx64, rid);
         return;
     }
-    auto counters_db = std::shared_ptr<swss::DBConnector>(new swss::DBConnector("COUNTERS_DB", 0));
-    std::string strVid = otai_serialize_object_id(vid);
-    auto key = counters_db->hget(COUNTERS_OT_APS_NAME_MAP, strVid);
-    if (key == nullptr)
+    std::string name;
+    if (!getObjectName(COUNTERS_OT_APS_NAME_MAP, vid, name))
     {
-        SWSS_LOG_ERROR("cannot get name map, %s %s", COUNTERS_OT_APS_NAME_MAP, strVid.c_str());
+        SWSS_LOG_ERROR("cannot get name map, %s %s", COUNTERS_OT_APS_NAME_MAP, otai_serialize_object_id(vid).c_str());
         return;
     }
-    std::string strKey = *key;
+    std::string strKey = name;
     strKey += "_";
     strKey += j["time-stamp"];
 
@@ -218,29 +302,53 @@ void NotificationProcessor::handle_ocm_spectrum_power_notify(
 
     linecard_vid = m_translator->translateRidToVid(linecard_rid, OTAI_NULL_OBJECT_ID);
 
-    auto counters_db = std::shared_ptr<swss::DBConnector>(new swss::DBConnector("COUNTERS_DB", 0));
-    std::string strVid = otai_serialize_object_id(vid);
-    auto key = counters_db->hget(COUNTERS_OT_OCM_NAME_MAP, strVid);
-    if (key == nullptr)
+    std::string name;
+    if (!getObjectName(COUNTERS_OT_OCM_NAME_MAP, vid, name))
     {
-        SWSS_LOG_ERROR("cannot get name map, %s %s", COUNTERS_OT_OCM_NAME_MAP, strVid.c_str());
+        SWSS_LOG_ERROR("cannot get name map, %s %s", COUNTERS_OT_OCM_NAME_MAP, otai_serialize_object_id(vid).c_str());
         return;
     }
 
-    for (uint32_t i = 0 ; i < list.count; i++)
+    // whole scan is written with single pipelined round trip
+
+    std::vector<std::string> commands;
+
+    if (m_ocmCompactEncoding)
+    {
+        std::string tableKey = m_stateOcmTable->getKeyName(name + "|" OCM_SPECTRUM_KEY_SUFFIX);
+
+        std::vector<swss::FieldValueTuple> values = {
+            { OCM_SPECTRUM_FIELD_ENCODING, OCM_SPECTRUM_ENCODING },
+            { OCM_SPECTRUM_FIELD_COUNT, otai_serialize_number(list.count) },
+            { OCM_SPECTRUM_FIELD_DATA, OcmSpectrum::pack(list) } };
+
+        addHmsetCommand(commands, tableKey, values);
+        addExpireCommand(commands, tableKey, OCM_SPECTRUM_TTL_SECONDS);
+    }
+    else
     {
-        std::string lowFreq = otai_serialize_number(list.list[i].lower_frequency);
-        std::string upFreq = otai_serialize_number(list.list[i].upper_frequency);
-        std::string power = otai_serialize_decimal(list.list[i].power);
+        commands.reserve(2 * list.count);
 
-        std::string tableKey = *key + '|' + lowFreq + '|' + upFreq;
+        for (uint32_t i = 0 ; i < list.count; i++)
+        {
+            std::string lowFreq = otai_serialize_number(list.list[i].lower_frequency);
+            std::string upFreq = otai_serialize_number(list.list[i].upper_frequency);
+            std::string power = otai_serialize_decimal(list.list[i].power);
+
+            std::string tableKey = m_stateOcmTable->getKeyName(name + '|' + lowFreq + '|' + upFreq);
+
+            std::vector<swss::FieldValueTuple> values = {
+                { "lower-frequency", lowFreq },
+                { "upper-frequency", upFreq },
+                { "power", power } };
 
-        m_stateOcmTable->hset(tableKey, "lower-frequency", lowFreq);
-        m_stateOcmTable->hset(tableKey, "upper-frequency", upFreq);
-        m_stateOcmTable->hset(tableKey, "power", power);
-        m_stateOcmTable->expire(tableKey, 60);  /* expire after 1 minute */
+            addHmsetCommand(commands, tableKey, values);
+            addExpireCommand(commands, tableKey, OCM_SPECTRUM_TTL_SECONDS);
+        }
     }
 
+    pipelineCommands(*m_state_db, commands);
+
     json j2;
 
     j2["linecard_id"] = otai_serialize_object_id(linecard_vid);
@@ -249,40 +357,141 @@ void NotificationProcessor::handle_ocm_spectrum_power_notify(
     sendNotification(OTAI_OCM_NOTIFICATION_NAME_SPECTRUM_POWER_NOTIFY, j2.dump());
 }
 
-void writeOtdrTable(
-        std::shared_ptr<Table> table,
-        std::string &key,
-        std::string &name,
-        json &j)
+void NotificationProcessor::setOcmCompactEncoding(
+    _In_ bool enable)
+{
+    SWSS_LOG_ENTER();
+
+    m_ocmCompactEncoding = enable;
+}
+
+void NotificationProcessor::setOtdrTraceEncoding(
+    _In_ const std::string& encoding)
 {
     SWSS_LOG_ENTER();
 
-    table->hset(key, "name", name);
-    table->hset(key, "scan-time", j["scan-time"]);
-    table->hset(key, "distance-range", j["distance-range"]);
-    table->hset(key, "pulse-width", j["pulse-width"]);
-    table->hset(key, "average-time", j["average-time"]);
-    table->hset(key, "output-frequency", j["output-frequency"]);
-    table->hset(key, "span-distance", j["span-distance"]);
-    table->hset(key, "span-loss", j["span-loss"]);
-    table->hset(key, "update-time", j["update-time"]);
-    table->hset(key, "data", j["data"]);
+    if (!OtdrTrace::isEncodingSupported(encoding))
+    {
+        SWSS_LOG_THROW("unsupported OTDR trace encoding %s", encoding.c_str());
+    }
+
+    m_otdrTraceEncoding = encoding;
 }
 
-void writeOtdrEventTable(
-        std::shared_ptr<Table> table,
-        std::string &key,
-        otai_otdr_event_t &e,
-        uint32_t index)
+void NotificationProcessor::addHmsetCommand(
+    _Inout_ std::vector<std::string>& commands,
+    _In_ const std::string& key,
+    _In_ const std::vector<swss::FieldValueTuple>& values)
 {
     SWSS_LOG_ENTER();
 
-    table->hset(key, "index", otai_serialize_number(index));
-    table->hset(key, "length", otai_serialize_decimal(e.length));
-    table->hset(key, "loss", otai_serialize_decimal(e.loss));
-    table->hset(key, "accumulate-loss", otai_serialize_decimal(e.accumulate_loss));
-    table->hset(key, "type", otai_serialize_enum(e.type, &otai_metadata_enum_otai_otdr_event_type_t));
-    table->hset(key, "reflection", otai_serialize_decimal(e.reflection));
+    // arguments are passed with explicit length, packed spectrum and OTDR
+    // trace contain zero bytes and formatHMSET would truncate them
+
+    std::vector<const char*> argv;
+    std::vector<size_t> argvlen;
+
+    argv.reserve(2 + 2 * values.size());
+    argvlen.reserve(2 + 2 * values.size());
+
+    argv.push_back("HMSET");
+    argvlen.push_back(5);
+
+    argv.push_back(key.c_str());
+    argvlen.push_back(key.size());
+
+    for (auto& fv: values)
+    {
+        argv.push_back(fvField(fv).c_str());
+        argvlen.push_back(fvField(fv).size());
+
+        argv.push_back(fvValue(fv).c_str());
+        argvlen.push_back(fvValue(fv).size());
+    }
+
+    swss::RedisCommand cmd;
+
+    cmd.formatArgv((int)argv.size(), argv.data(), argvlen.data());
+
+    commands.emplace_back(cmd.c_str(), cmd.length());
+}
+
+void NotificationProcessor::addExpireCommand(
+    _Inout_ std::vector<std::string>& commands,
+    _In_ const std::string& key,
+    _In_ int64_t ttl)
+{
+    SWSS_LOG_ENTER();
+
+    swss::RedisCommand cmd;
+
+    cmd.format("EXPIRE %s %" PRId64, key.c_str(), ttl);
+
+    commands.emplace_back(cmd.c_str(), cmd.length());
+}
+
+void NotificationProcessor::addHincrbyCommand(
+    _Inout_ std::vector<std::string>& commands,
+    _In_ const std::string& key,
+    _In_ const std::string& field,
+    _In_ uint64_t increment)
+{
+    SWSS_LOG_ENTER();
+
+    swss::RedisCommand cmd;
+
+    cmd.format("HINCRBY %s %s %" PRIu64, key.c_str(), field.c_str(), increment);
+
+    commands.emplace_back(cmd.c_str(), cmd.length());
+}
+
+void NotificationProcessor::addDelCommand(
+    _Inout_ std::vector<std::string>& commands,
+    _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    swss::RedisCommand cmd;
+
+    cmd.format("DEL %s", key.c_str());
+
+    commands.emplace_back(cmd.c_str(), cmd.length());
+}
+
+void NotificationProcessor::pipelineCommands(
+    _In_ swss::DBConnector& db,
+    _In_ const std::vector<std::string>& commands)
+{
+    SWSS_LOG_ENTER();
+
+    redisContext* ctx = db.getContext();
+
+    for (auto& cmd: commands)
+    {
+        if (redisAppendFormattedCommand(ctx, cmd.c_str(), cmd.length()) != REDIS_OK)
+        {
+            SWSS_LOG_THROW("failed to append command to pipeline: %s", ctx->errstr);
+        }
+    }
+
+    // all replies must be consumed, connection is shared with other tables
+
+    for (size_t i = 0; i < commands.size(); i++)
+    {
+        redisReply* reply = NULL;
+
+        if (redisGetReply(ctx, (void**)&reply) != REDIS_OK)
+        {
+            SWSS_LOG_THROW("failed to get pipelined reply: %s", ctx->errstr);
+        }
+
+        swss::RedisReply r(reply);
+
+        if (reply->type == REDIS_REPLY_ERROR)
+        {
+            SWSS_LOG_ERROR("pipelined command failed: %s", reply->str);
+        }
+    }
 }
 
 void NotificationProcessor::handle_otdr_result_notify(
@@ -304,79 +513,146 @@ void NotificationProcessor::handle_otdr_result_notify(
         return;
     }
 
-    auto counters_db = std::shared_ptr<swss::DBConnector>(new swss::DBConnector("COUNTERS_DB", 0));
+    std::string name;
 
-    std::string strVid = otai_serialize_object_id(otdrVid);
-
-    auto key = counters_db->hget(COUNTERS_OT_OTDR_NAME_MAP, strVid);
-
-    if (key == nullptr)
+    if (!getObjectName(COUNTERS_OT_OTDR_NAME_MAP, otdrVid, name))
     {
-        SWSS_LOG_ERROR("cannot get name map, %s %s", COUNTERS_OT_OTDR_NAME_MAP, strVid.c_str());
+        SWSS_LOG_ERROR("cannot get name map, %s %s", COUNTERS_OT_OTDR_NAME_MAP, otai_serialize_object_id(otdrVid).c_str());
         return;
     }
 
-    std::string stateTableKey = *key + "|CURRENT";
+    // trace and events arrive as binary fields, trace is stored encoded with
+    // its size, events as packed array, see OtdrTrace
 
-    writeOtdrTable(m_stateOtdrTable, stateTableKey, *key, j);
+    std::string trace;
+    std::string events;
 
-    otai_otdr_event_list_t events;
+    for (auto& f: fv)
+    {
+        if (fvField(f) == OTDR_FIELD_DATA)
+        {
+            trace = fvValue(f);
+        }
+        else if (fvField(f) == OTDR_FIELD_EVENTS)
+        {
+            events = fvValue(f);
+        }
+    }
 
-    otai_deserialize_otdr_event_list(j["events"], events);
+    std::string strScanTime = j["scan-time"].get<std::string>();
 
-    for (uint32_t i = 0; i < events.count; i++)
-    {
-        uint32_t index = i + 1;
+    std::vector<swss::FieldValueTuple> values = {
+        { "name", name },
+        { "scan-time", strScanTime },
+        { "distance-range", j["distance-range"].get<std::string>() },
+        { "pulse-width", j["pulse-width"].get<std::string>() },
+        { "average-time", j["average-time"].get<std::string>() },
+        { "output-frequency", j["output-frequency"].get<std::string>() },
+        { "span-distance", j["span-distance"].get<std::string>() },
+        { "span-loss", j["span-loss"].get<std::string>() },
+        { "update-time", j["update-time"].get<std::string>() } };
 
-        std::string eventKey = *key + "|CURRENT|" + otai_serialize_number(index);
+    std::string stateTableKey = m_stateOtdrTable->getKeyName(name + "|CURRENT");
+    std::string historyTableKey = name + "|" + strScanTime;
 
-        writeOtdrEventTable(m_stateOtdrEventTable, eventKey, events.list[i], index);
-    }
+    std::vector<std::string> stateCommands;
+    std::vector<std::string> historyCommands;
 
-    std::string strScanTime = j["scan-time"];
-    std::string historyTableKey = *key + "|" + strScanTime;
+    // current entry is replaced, so fields of other encoding don't remain
+    // when encoding changed
 
-    writeOtdrTable(m_historyOtdrTable, historyTableKey, *key, j);
+    addDelCommand(stateCommands, stateTableKey);
 
-    for (uint32_t i = 0; i < events.count; i++)
+    if (m_otdrTraceEncoding == OTDR_TRACE_ENCODING_TEXT)
     {
-        uint32_t index = i + 1;
+        // layout read by existing consumers, hex trace in OTDR entry and
+        // event per OTDR_EVENT key
 
-        std::string eventKey = *key + "|" + strScanTime + "|" + otai_serialize_number(index);
+        values.emplace_back(OTDR_FIELD_DATA, OtdrTrace::encodeTrace(trace, m_otdrTraceEncoding));
 
-        writeOtdrEventTable(m_historyOtdrEventTable, eventKey, events.list[i], index);
-    }
+        addHmsetCommand(stateCommands, stateTableKey, values);
+        addHmsetCommand(historyCommands, m_historyOtdrTable->getKeyName(historyTableKey), values);
 
-    uint64_t scanTime = 0;
+        auto entries = OtdrTrace::unpackEvents(events);
 
-    otai_deserialize_number(j["scan-time"], scanTime);
+        std::vector<std::string> eventKeys;
 
-    m_otdrScanTimeQueue[*key].push(scanTime);
+        for (size_t i = 0; i < entries.size(); i++)
+        {
+            auto& e = entries[i];
+
+            std::string index = otai_serialize_number(i + 1);
+
+            std::vector<swss::FieldValueTuple> eventValues = {
+                { "index", index },
+                { "length", otai_serialize_decimal(e.m_length) },
+                { "loss", otai_serialize_decimal(e.m_loss) },
+                { "accumulate-loss", otai_serialize_decimal(e.m_accumulateLoss) },
+                { "type", otai_serialize_enum((int32_t)e.m_type, &otai_metadata_enum_otai_otdr_event_type_t) },
+                { "reflection", otai_serialize_decimal(e.m_reflection) } };
+
+            eventKeys.push_back(m_historyOtdrEventTable->getKeyName(historyTableKey + "|" + index));
 
-    while (m_otdrScanTimeQueue[*key].size() > 10)
+            addHmsetCommand(stateCommands, m_stateOtdrEventTable->getKeyName(name + "|CURRENT|" + index), eventValues);
+            addHmsetCommand(historyCommands, eventKeys.back(), eventValues);
+        }
+
+        m_historyOtdrEventIndex->addInsertCommands(historyCommands, eventKeys);
+    }
+    else
     {
-        scanTime = m_otdrScanTimeQueue[*key].front(); 
+        values.emplace_back(OTDR_FIELD_DATA_ENCODING, m_otdrTraceEncoding);
+        values.emplace_back(OTDR_FIELD_DATA_SIZE, otai_serialize_number(trace.size()));
+        values.emplace_back(OTDR_FIELD_DATA, OtdrTrace::encodeTrace(trace, m_otdrTraceEncoding));
+        values.emplace_back(OTDR_FIELD_EVENT_COUNT, otai_serialize_number(OtdrTrace::unpackEvents(events).size()));
+        values.emplace_back(OTDR_FIELD_EVENTS, events);
+
+        addHmsetCommand(stateCommands, stateTableKey, values);
+        addHmsetCommand(historyCommands, m_historyOtdrTable->getKeyName(historyTableKey), values);
+    }
+
+    pipelineCommands(*m_state_db, stateCommands);
+    pipelineCommands(*m_history_db, historyCommands);
+
+    uint64_t scanTime = 0;
+
+    otai_deserialize_number(strScanTime, scanTime);
 
-        m_otdrScanTimeQueue[*key].pop();
+    m_historyOtdrTimeIndex->insert(name, m_historyOtdrTable->getKeyName(historyTableKey), scanTime);
 
-        std::string entry = m_historyOtdrTable->getTableName() + ":" +
-                            *key + "|" + otai_serialize_number(scanTime);
+    auto entries = m_historyOtdrTimeIndex->trim(name, OTDR_HISTORY_SCAN_COUNT);
 
+    for (auto& entry: entries)
+    {
         SWSS_LOG_INFO("Delete old otdr data, %s", entry.c_str());
 
-        m_history_db->del(entry);
+        auto delimiter = entry.find_last_of("|");
+
+        if (delimiter == std::string::npos)
+        {
+            continue;
+        }
 
-        std::string pattern = m_historyOtdrEventTable->getTableName() + ":" +
-                              *key + "|" + otai_serialize_number(scanTime) + "*";
+        std::string bucket = name + entry.substr(delimiter);
 
-        auto keys = m_history_db->keys(pattern);
+        auto keys = m_historyOtdrEventIndex->getKeys(bucket);
 
         for (auto &k : keys)
         {
             SWSS_LOG_INFO("Delete old otdr event data, %s", k.c_str());
+        }
 
-            m_history_db->del(k);
+        if (keys.size())
+        {
+            m_history_db->del(keys);
         }
+
+        m_historyOtdrEventIndex->removeBucket(bucket);
+    }
+
+    if (entries.size())
+    {
+        m_history_db->del(entries);
     }
 }
 
@@ -390,18 +666,182 @@ void NotificationProcessor::handle_linecard_alarm(
     otai_alarm_info_t alarm_info;
 
     otai_deserialize_linecard_alarm(data, linecard_id, alarm_type, alarm_info);
-    if (alarm_info.status == OTAI_ALARM_STATUS_ACTIVE)
+
+    if (alarm_info.status != OTAI_ALARM_STATUS_ACTIVE && alarm_info.status != OTAI_ALARM_STATUS_INACTIVE)
+    {
+        handler_event_generated(data);
+        return;
+    }
+
+    bool active = (alarm_info.status == OTAI_ALARM_STATUS_ACTIVE);
+
+    json j = json::parse(data);
+
+    otai_object_id_t rid;
+    otai_deserialize_object_id(j["resource_oid"], rid);
+
+    std::string resource = get_resource_name_by_rid(rid);
+    std::string type_id = j["type-id"];
+    std::string keyid = resource + "#" + type_id;
+
+    auto action = m_alarmDamping->onTransition(keyid, type_id, resource, active, std::chrono::steady_clock::now());
+
+    if (action == ALARM_DAMPING_ACTION_APPLY)
+    {
+        if (active)
+        {
+            handler_alarm_generated(data);
+        }
+        else
+        {
+            handler_alarm_cleared(data);
+        }
+
+        return;
+    }
+
+    // only latest transition is kept, it is applied when damping expires
+
+    m_dampedAlarms[keyid] = std::make_pair(active, data);
+
+    if (action == ALARM_DAMPING_ACTION_FLAPPING)
     {
+        markAlarmFlapping(keyid, data, active);
+    }
+}
+
+void NotificationProcessor::markAlarmFlapping(
+    _In_ const std::string& keyid,
+    _In_ const std::string& data,
+    _In_ bool active)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_currentAlarms.find(keyid);
+
+    if (it == m_currentAlarms.end())
+    {
+        // flapping alarm is reported as raised until it settles
+
+        if (!active)
+        {
+            return;
+        }
+
         handler_alarm_generated(data);
+
+        it = m_currentAlarms.find(keyid);
+
+        if (it == m_currentAlarms.end())
+        {
+            return;
+        }
+    }
+
+    std::vector<FieldValueTuple> values = {
+        { "flapping", "true" },
+        { "flap-count", otai_serialize_number(m_alarmDamping->getTransitionCount(keyid)) } };
+
+    // fields can be present already, alarm loaded after restart or flapping
+    // again before unmark, they are replaced in place
+
+    for (auto& fv: values)
+    {
+        auto field = std::find_if(it->second.begin(), it->second.end(), [&fv](const FieldValueTuple& current) {
+                return fvField(current) == fvField(fv);
+                });
+
+        if (field == it->second.end())
+        {
+            it->second.push_back(fv);
+        }
+        else
+        {
+            fvValue(*field) = fvValue(fv);
+        }
     }
-    else if (alarm_info.status == OTAI_ALARM_STATUS_INACTIVE)
+
+    addHmsetCommand(m_pendingStateCommands, m_stateAlarmable->getKeyName(keyid), values);
+}
+
+void NotificationProcessor::unmarkAlarmFlapping(
+    _In_ const std::string& keyid)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_currentAlarms.find(keyid);
+
+    if (it == m_currentAlarms.end())
     {
-        handler_alarm_cleared(data);
+        return;
     }
-    else
+
+    auto& values = it->second;
+
+    values.erase(std::remove_if(values.begin(), values.end(), [](const FieldValueTuple& fv) {
+                return fvField(fv) == "flapping" || fvField(fv) == "flap-count";
+                }), values.end());
+
+    std::string key = m_stateAlarmable->getKeyName(keyid);
+
+    addDelCommand(m_pendingStateCommands, key);
+    addHmsetCommand(m_pendingStateCommands, key, values);
+}
+
+void NotificationProcessor::processAlarmDamping()
+{
+    SWSS_LOG_ENTER();
+
+    auto now = std::chrono::steady_clock::now();
+
+    for (auto& expiry: m_alarmDamping->getExpired(now))
     {
-        handler_event_generated(data);
+        if (expiry.m_flapEnded)
+        {
+            unmarkAlarmFlapping(expiry.m_alarmId);
+        }
+
+        auto it = m_dampedAlarms.find(expiry.m_alarmId);
+
+        if (it == m_dampedAlarms.end())
+        {
+            continue;
+        }
+
+        auto held = std::move(it->second);
+
+        m_dampedAlarms.erase(it);
+
+        if (held.first)
+        {
+            handler_alarm_generated(held.second);
+        }
+        else
+        {
+            handler_alarm_cleared(held.second);
+        }
     }
+
+    // counts are increments, alarm states are dropped by damping when idle,
+    // so published counts stay cumulative
+
+    for (auto& kvp: m_alarmDamping->getChangedStatistics(now))
+    {
+        auto key = m_stateAlarmDampingTable->getKeyName(kvp.first);
+
+        addHincrbyCommand(m_pendingStateCommands, key, "transition-count", kvp.second.m_transitionCount);
+        addHincrbyCommand(m_pendingStateCommands, key, "suppressed-count", kvp.second.m_suppressedCount);
+
+        addHmsetCommand(m_pendingStateCommands, key, { { "flapping", kvp.second.m_flapping ? "true" : "false" } });
+    }
+}
+
+void NotificationProcessor::setAlarmDampingConfig(
+    _In_ const std::string& path)
+{
+    SWSS_LOG_ENTER();
+
+    m_alarmDamping->loadConfig(path);
 }
 
 std::string NotificationProcessor::get_resource_name_by_rid(
@@ -418,17 +858,78 @@ std::string NotificationProcessor::get_resource_name_by_rid(
         return "";
     }
 
-    auto counters_db = std::shared_ptr<swss::DBConnector>(new swss::DBConnector("COUNTERS_DB", 0));
-    std::string strVid = otai_serialize_object_id(vid);
-    auto key = counters_db->hget("VID2NAME", strVid);
-    if (key == NULL)
+    std::string name;
+
+    if (!getObjectName("VID2NAME", vid, name))
     {
         SWSS_LOG_ERROR("Failed to get name from VID2NAME, vid=0x%" PRIx64, vid);
 
         return "";
     }
 
-    return *key;
+    return name;
+}
+
+bool NotificationProcessor::getObjectName(
+        _In_ const std::string& nameMap,
+        _In_ otai_object_id_t vid,
+        _Out_ std::string& name)
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::mutex> lock(m_nameCacheMutex);
+
+        auto& cache = m_nameCache[nameMap];
+
+        auto it = cache.find(vid);
+
+        if (it != cache.end())
+        {
+            name = it->second;
+
+            return true;
+        }
+    }
+
+    // missing names are not cached, name map can be populated later
+
+    auto value = m_counters_db->hget(nameMap, otai_serialize_object_id(vid));
+
+    if (value == nullptr)
+    {
+        return false;
+    }
+
+    name = *value;
+
+    std::lock_guard<std::mutex> lock(m_nameCacheMutex);
+
+    m_nameCache[nameMap][vid] = name;
+
+    return true;
+}
+
+void NotificationProcessor::invalidateObjectName(
+        _In_ otai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_nameCacheMutex);
+
+    for (auto& kvp: m_nameCache)
+    {
+        kvp.second.erase(vid);
+    }
+}
+
+void NotificationProcessor::clearObjectNames()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_nameCacheMutex);
+
+    m_nameCache.clear();
 }
 
 void NotificationProcessor::handler_event_generated(
@@ -466,9 +967,9 @@ void NotificationProcessor::handler_event_generated(
     tupletemp = std::make_pair("resource", resource);
     alarmVector.emplace_back(tupletemp);
 
-    std::string strKey = keyid + "#" + timecreated;
-    m_historyEventTable->set(strKey, alarmVector);
-    m_historyEventTable->expire(strKey, m_ttlAlarm);
+    std::string strKey = m_historyEventTable->getKeyName(keyid + "#" + timecreated);
+    addHmsetCommand(m_pendingHistoryCommands, strKey, alarmVector);
+    addExpireCommand(m_pendingHistoryCommands, strKey, m_ttlAlarm);
     SWSS_LOG_WARN("EVENT generated key:%s content:%s", strKey.c_str(), data.c_str());
 }
 
@@ -480,7 +981,6 @@ void NotificationProcessor::handler_alarm_generated(
     std::vector<FieldValueTuple> alarmVector;
     std::vector<FieldValueTuple> vectortemp;
 
-    bool alarmstatus;
     json j = json::parse(data);
     FieldValueTuple tupletemp;
     std::string keyid;
@@ -499,9 +999,7 @@ void NotificationProcessor::handler_alarm_generated(
     keyid = j["id"] = resource + "#" + type_id;
     j["time-created"] = timecreated;
 
-    alarmstatus = m_stateAlarmable->get(keyid, vectortemp);
-
-    if (alarmstatus == true)
+    if (m_currentAlarms.find(keyid) != m_currentAlarms.end())
     {
         SWSS_LOG_NOTICE("alarm already generated(%s)", keyid.c_str());
         return;
@@ -515,7 +1013,9 @@ void NotificationProcessor::handler_alarm_generated(
     tupletemp = std::make_pair("resource", resource);
     alarmVector.emplace_back(tupletemp);
 
-    m_stateAlarmable->set(keyid, alarmVector);
+    addHmsetCommand(m_pendingStateCommands, m_stateAlarmable->getKeyName(keyid), alarmVector);
+    m_currentAlarms[keyid] = alarmVector;
+    m_currentAlarmLinecards[keyid] = getAlarmLinecard(j);
     SWSS_LOG_WARN("ALARM generated key:%s content:%s", keyid.c_str(), data.c_str());
 }
 
@@ -524,9 +1024,11 @@ void NotificationProcessor::handler_history_alarm(
     _In_ const std::string& timecreated,
     _In_ const std::vector<FieldValueTuple>& alarmvector)
 {
-    std::string strKey = key + "#" + timecreated;
-    m_historyAlarmTable->set(strKey, alarmvector);
-    m_historyAlarmTable->expire(strKey, m_ttlAlarm);
+    SWSS_LOG_ENTER();
+
+    std::string strKey = m_historyAlarmTable->getKeyName(key + "#" + timecreated);
+    addHmsetCommand(m_pendingHistoryCommands, strKey, alarmvector);
+    addExpireCommand(m_pendingHistoryCommands, strKey, m_ttlAlarm);
 }
 
 void NotificationProcessor::handler_alarm_cleared(
@@ -535,8 +1037,6 @@ void NotificationProcessor::handler_alarm_cleared(
     SWSS_LOG_ENTER();
 
     std::string keyid;
-    bool alarmstatus;
-    std::vector<FieldValueTuple> vectortemp;
     std::string resource, type_id;
 
     json j = json::parse(data);
@@ -548,24 +1048,127 @@ void NotificationProcessor::handler_alarm_cleared(
     type_id = j["type-id"];
 
     keyid = resource + "#" + type_id;
-    alarmstatus = m_stateAlarmable->get(keyid, vectortemp);
 
-    if (alarmstatus == false)
+    auto it = m_currentAlarms.find(keyid);
+
+    if (it == m_currentAlarms.end())
     {
         SWSS_LOG_WARN("alarm already cleared(%s)", keyid.c_str());
         return;
     }
     else
     {
+        std::vector<FieldValueTuple> vectortemp = std::move(it->second);
+        m_currentAlarms.erase(it);
+        m_currentAlarmLinecards.erase(keyid);
+
         std::string time_cleared = j["time-created"];//the attribute "time-created" is actually the time of alarm cleared.
         FieldValueTuple tupletemp = std::make_pair("time-cleared", time_cleared);
         vectortemp.push_back(tupletemp);
         handler_history_alarm(keyid, time_cleared, vectortemp);
-        m_stateAlarmable->del(keyid);
+        addDelCommand(m_pendingStateCommands, m_stateAlarmable->getKeyName(keyid));
         SWSS_LOG_WARN("ALARM cleared key:%s content:%s", keyid.c_str(), data.c_str());
     }
 }
 
+void NotificationProcessor::flushCurrentAlarms(
+    _In_ otai_object_id_t linecard_rid)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> flushed;
+
+    for (auto it = m_currentAlarms.begin(); it != m_currentAlarms.end();)
+    {
+        // linecard of alarms loaded from STATE DB is not known, they are
+        // flushed with any linecard
+
+        auto linecard = m_currentAlarmLinecards.find(it->first);
+
+        if (linecard != m_currentAlarmLinecards.end())
+        {
+            if (linecard->second != linecard_rid)
+            {
+                it++;
+                continue;
+            }
+
+            m_currentAlarmLinecards.erase(linecard);
+        }
+
+        addDelCommand(m_pendingStateCommands, m_stateAlarmable->getKeyName(it->first));
+
+        flushed.push_back(it->first);
+
+        it = m_currentAlarms.erase(it);
+    }
+
+    // held transitions were reported before flush, they must not raise or
+    // clear alarm after it
+
+    for (auto it = m_dampedAlarms.begin(); it != m_dampedAlarms.end();)
+    {
+        if (getAlarmLinecard(json::parse(it->second.second)) != linecard_rid)
+        {
+            it++;
+            continue;
+        }
+
+        flushed.push_back(it->first);
+
+        it = m_dampedAlarms.erase(it);
+    }
+
+    SWSS_LOG_NOTICE("flushed %zu current and held alarms of linecard %s",
+            flushed.size(),
+            otai_serialize_object_id(linecard_rid).c_str());
+
+    m_alarmDamping->clear(flushed);
+}
+
+void NotificationProcessor::loadCurrentAlarms()
+{
+    SWSS_LOG_ENTER();
+
+    // syncd is only writer of current alarms, so table is read once and
+    // then kept in memory, raise and clear checks don't read redis
+
+    std::string prefix = m_stateAlarmable->getKeyName("");
+
+    auto keys = RedisKeyIndex::scanKeys(*m_state_db, prefix + "*");
+
+    auto values = RedisClient::pipelineHgetall(*m_state_db, keys);
+
+    m_currentAlarms.clear();
+    m_currentAlarmLinecards.clear();
+
+    for (size_t idx = 0; idx < keys.size(); idx++)
+    {
+        m_currentAlarms[keys[idx].substr(prefix.size())] = std::move(values[idx]);
+    }
+
+    SWSS_LOG_NOTICE("loaded %zu current alarms", m_currentAlarms.size());
+}
+
+void NotificationProcessor::flushPendingCommands()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pendingStateCommands.size())
+    {
+        pipelineCommands(*m_state_db, m_pendingStateCommands);
+
+        m_pendingStateCommands.clear();
+    }
+
+    if (m_pendingHistoryCommands.size())
+    {
+        pipelineCommands(*m_history_db, m_pendingHistoryCommands);
+
+        m_pendingHistoryCommands.clear();
+    }
+}
+
 void NotificationProcessor::processNotification(
     _In_ const swss::KeyOpFieldsValuesTuple& item)
 {
@@ -603,6 +1206,18 @@ void NotificationProcessor::syncProcessNotification(
     {
         handle_otdr_result_notify(data, fv);
     }
+    else if (notification == ALARM_DAMPING_TIMER_NOTIFICATION)
+    {
+        processAlarmDamping();
+    }
+    else if (notification == NOTIFICATION_QUEUE_CURRENT_ALARMS_FLUSH)
+    {
+        otai_object_id_t linecard_rid;
+
+        otai_deserialize_object_id(data, linecard_rid);
+
+        flushCurrentAlarms(linecard_rid);
+    }
     else
     {
         SWSS_LOG_ERROR("unknown notification: %s", notification.c_str());
@@ -613,26 +1228,70 @@ void NotificationProcessor::ntf_process_function()
 {
     SWSS_LOG_ENTER();
 
-    std::mutex ntf_mutex;
-
-    std::unique_lock<std::mutex> ulock(ntf_mutex);
+    std::vector<swss::KeyOpFieldsValuesTuple> items;
 
     while (m_runThread)
     {
-        m_cv.wait(ulock);
+        // wake up periodically, so statistics of drops which happened while
+        // processing are published
+
+        auto timeout = std::chrono::milliseconds(NOTIFICATION_WAIT_TIMEOUT_MS);
+
+        auto deadline = m_alarmDamping->getNextDeadline();
+
+        auto now = std::chrono::steady_clock::now();
+
+        if (deadline < now + timeout)
+        {
+            timeout = std::chrono::duration_cast<std::chrono::milliseconds>(std::max(deadline - now, std::chrono::steady_clock::duration::zero()));
+        }
+
+        m_notificationQueue->wait((int)timeout.count());
 
         // this is notifications processing thread context, which is different
         // from OTAI notifications context, we can safe use syncd mutex here,
         // processing each notification is under same mutex as processing main
         // events, counters and reinit
 
-        swss::KeyOpFieldsValuesTuple item;
+        while (m_notificationQueue->dequeueBatch(items, NOTIFICATION_DEQUEUE_BATCH_SIZE))
+        {
+            for (auto& item: items)
+            {
+                processNotification(item);
+            }
+
+            items.clear();
+
+            // alarm writes of whole batch are sent in single round trip
 
-        while (m_notificationQueue->tryDequeue(item))
+            flushPendingCommands();
+        }
+
+        if (m_alarmDamping->getNextDeadline() <= std::chrono::steady_clock::now())
         {
-            processNotification(item);
+            processNotification(swss::KeyOpFieldsValuesTuple(ALARM_DAMPING_TIMER_NOTIFICATION, "", std::vector<swss::FieldValueTuple>()));
+
+            flushPendingCommands();
         }
+
+        publishQueueStatistics();
+    }
+}
+
+void NotificationProcessor::publishQueueStatistics()
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t version = m_notificationQueue->getStatisticsVersion();
+
+    if (version == m_queueStatisticsVersion)
+    {
+        return;
     }
+
+    m_queueStatisticsVersion = version;
+
+    m_stateNotificationQueueTable->set(SYNCD_NOTIFICATION_QUEUE_KEY, m_notificationQueue->getStatistics());
 }
 
 void NotificationProcessor::startNotificationsProcessingThread()
@@ -650,7 +1309,7 @@ void NotificationProcessor::stopNotificationsProcessingThread()
 
     m_runThread = false;
 
-    m_cv.notify_all();
+    m_notificationQueue->signal();
 
     if (m_ntf_process_thread != nullptr)
     {
@@ -664,7 +1323,7 @@ void NotificationProcessor::signal()
 {
     SWSS_LOG_ENTER();
 
-    m_cv.notify_all();
+    m_notificationQueue->signal();
 }
 
 std::shared_ptr<NotificationQueue> NotificationProcessor::getQueue() const
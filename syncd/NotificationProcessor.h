@@ -3,15 +3,20 @@
 #include <mutex>
 #include <thread>
 #include <memory>
-#include <condition_variable>
 #include <functional>
 #include <queue>
+#include <map>
+#include <unordered_map>
 
 #include "otairediscommon.h"
 #include "NotificationQueue.h"
 #include "VirtualOidTranslator.h"
 #include "RedisClient.h"
+#include "RedisKeyIndex.h"
+#include "RedisTimeIndex.h"
+#include "AlarmDamping.h"
 #include "NotificationProducerBase.h"
+#include "ContextConfig.h"
 
 #include "swss/notificationproducer.h"
 
@@ -24,6 +29,7 @@ namespace syncd
         NotificationProcessor(
             _In_ std::shared_ptr<NotificationProducerBase> producer,
             _In_ std::shared_ptr<RedisClient> client,
+            _In_ std::shared_ptr<otairedis::ContextConfig> contextConfig,
             _In_ std::function<void(const swss::KeyOpFieldsValuesTuple&)> synchronizer);
 
         virtual ~NotificationProcessor();
@@ -42,6 +48,12 @@ namespace syncd
 
         void ntf_process_function();
 
+        /**
+         * @brief Publish notification queue statistics to STATE DB when
+         * queue dropped or coalesced notifications since last publish.
+         */
+        void publishQueueStatistics();
+
         void sendNotification(
             _In_ const std::string& op,
             _In_ const std::string& data,
@@ -97,13 +109,117 @@ namespace syncd
         void processNotification(
             _In_ const swss::KeyOpFieldsValuesTuple& item);
 
-        void initOtdrScanTimeSet();
+        /**
+         * @brief Apply held alarm transitions which damping expired and
+         * publish raw transition counts.
+         */
+        void processAlarmDamping();
+
+        void markAlarmFlapping(
+            _In_ const std::string& keyid,
+            _In_ const std::string& data,
+            _In_ bool active);
+
+        void unmarkAlarmFlapping(
+            _In_ const std::string& keyid);
+
+        /**
+         * @brief Remove current alarms of linecard from STATE DB and memory
+         * and drop its held alarm transitions.
+         *
+         * Alarms loaded from STATE DB on start have unknown linecard and
+         * are removed with any linecard.
+         */
+        void flushCurrentAlarms(
+            _In_ otai_object_id_t linecard_rid);
+
+        /**
+         * @brief Load current alarms from STATE DB to m_currentAlarms.
+         */
+        void loadCurrentAlarms();
+
+        /**
+         * @brief Send buffered alarm and event writes, single pipeline per
+         * database.
+         */
+        void flushPendingCommands();
 
     public:
 
         void syncProcessNotification(
             _In_ const swss::KeyOpFieldsValuesTuple& item);
 
+        /**
+         * @brief Drop cached names of removed object.
+         */
+        void invalidateObjectName(
+            _In_ otai_object_id_t vid);
+
+        void clearObjectNames();
+
+        /**
+         * @brief Store OCM spectrum as single packed value, see OcmSpectrum.
+         */
+        void setOcmCompactEncoding(
+            _In_ bool enable);
+
+        /**
+         * @brief Set encoding of stored OTDR traces, see OtdrTrace.
+         */
+        void setOtdrTraceEncoding(
+            _In_ const std::string& encoding);
+
+        /**
+         * @brief Load alarm damping configuration, see AlarmDamping.
+         */
+        void setAlarmDampingConfig(
+            _In_ const std::string& path);
+
+    public:
+
+        /**
+         * @brief Format HMSET of given values, values are binary safe.
+         */
+        static void addHmsetCommand(
+            _Inout_ std::vector<std::string>& commands,
+            _In_ const std::string& key,
+            _In_ const std::vector<swss::FieldValueTuple>& values);
+
+        static void addExpireCommand(
+            _Inout_ std::vector<std::string>& commands,
+            _In_ const std::string& key,
+            _In_ int64_t ttl);
+
+        static void addHincrbyCommand(
+            _Inout_ std::vector<std::string>& commands,
+            _In_ const std::string& key,
+            _In_ const std::string& field,
+            _In_ uint64_t increment);
+
+        static void addDelCommand(
+            _Inout_ std::vector<std::string>& commands,
+            _In_ const std::string& key);
+
+        /**
+         * @brief Send formatted commands in single round trip.
+         */
+        static void pipelineCommands(
+            _In_ swss::DBConnector& db,
+            _In_ const std::vector<std::string>& commands);
+
+    private:
+
+        /**
+         * @brief Get object name from COUNTERS DB name map.
+         *
+         * Names are cached per name map and VID, so repeated notifications
+         * from the same object don't query redis.
+         */
+        bool getObjectName(
+            _In_ const std::string& nameMap,
+            _In_ otai_object_id_t vid,
+            _Out_ std::string& name);
+
     public: // TODO to private
 
         std::shared_ptr<VirtualOidTranslator> m_translator;
@@ -114,11 +230,6 @@ namespace syncd
 
         std::shared_ptr<std::thread> m_ntf_process_thread;
 
-        // condition variable will be used to notify processing thread
-        // that some notification arrived
-
-        std::condition_variable m_cv;
-
         // determine whether notification thread is running
 
         bool m_runThread;
@@ -128,15 +239,54 @@ namespace syncd
         std::shared_ptr<RedisClient> m_client;
 
         std::shared_ptr<NotificationProducerBase> m_notifications;
+
+        std::shared_ptr<swss::DBConnector> m_counters_db;
+
+        std::shared_ptr<swss::DBConnector> m_asic_db;
+        std::shared_ptr<swss::NotificationProducer> m_linecardStateProducer;
+
+        std::mutex m_nameCacheMutex;
+
+        std::map<std::string, std::unordered_map<otai_object_id_t, std::string>> m_nameCache;
+
         std::shared_ptr<swss::DBConnector> m_state_db;
 
         std::unique_ptr<swss::Table> m_stateAlarmable;
+
+        /**
+         * @brief Current alarms by alarm id, authoritative copy of CURALARM
+         * table, which is only written by syncd.
+         */
+        std::unordered_map<std::string, std::vector<swss::FieldValueTuple>> m_currentAlarms;
+
+        /**
+         * @brief Linecard RID of current alarms raised since start.
+         */
+        std::unordered_map<std::string, otai_object_id_t> m_currentAlarmLinecards;
+
+        std::vector<std::string> m_pendingStateCommands;
+
+        std::shared_ptr<AlarmDamping> m_alarmDamping;
+
+        /**
+         * @brief Latest held transition per alarm id, active flag and
+         * notification data.
+         */
+        std::unordered_map<std::string, std::pair<bool, std::string>> m_dampedAlarms;
+
+        std::unique_ptr<swss::Table> m_stateAlarmDampingTable;
+
+        std::vector<std::string> m_pendingHistoryCommands;
         std::unique_ptr<swss::Table> m_stateOLPSwitchInfoTbl;
         std::unique_ptr<swss::Table> m_stateOcmTable;
 
         std::shared_ptr<swss::Table> m_stateOtdrTable;
         std::shared_ptr<swss::Table> m_stateOtdrEventTable;
 
+        std::unique_ptr<swss::Table> m_stateNotificationQueueTable;
+
+        uint64_t m_queueStatisticsVersion;
+
         std::shared_ptr<swss::DBConnector> m_history_db;
         std::unique_ptr<swss::Table> m_historyAlarmTable;
         std::unique_ptr<swss::Table> m_historyEventTable;
@@ -144,10 +294,15 @@ namespace syncd
         std::shared_ptr<swss::Table> m_historyOtdrTable;
         std::shared_ptr<swss::Table> m_historyOtdrEventTable;
 
-        std::map<std::string, std::queue<uint64_t>> m_otdrScanTimeQueue;
+        std::shared_ptr<RedisTimeIndex> m_historyOtdrTimeIndex;
+        std::shared_ptr<RedisKeyIndex> m_historyOtdrEventIndex;
 
         uint32_t m_ttlPM15Min;
         uint32_t m_ttlPM24Hour;
         uint32_t m_ttlAlarm;
+
+        bool m_ocmCompactEncoding;
+
+        std::string m_otdrTraceEncoding;
     };
 }
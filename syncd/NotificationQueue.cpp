@@ -1,20 +1,43 @@
 #include "NotificationQueue.h"
 #include "otairediscommon.h"
 
+#include "meta/otai_serialize.h"
+
+#include <thread>
+
 #define NOTIFICATION_QUEUE_DROP_COUNT_INDICATOR (1000)
 
 using namespace syncd;
 
-#define MUTEX std::lock_guard<std::mutex> _lock(m_mutex);
+static_assert((NOTIFICATION_QUEUE_RING_SIZE & (NOTIFICATION_QUEUE_RING_SIZE - 1)) == 0, "ring size must be power of 2");
 
 NotificationQueue::NotificationQueue(
         _In_ size_t queueLimit):
+    m_ringMask(NOTIFICATION_QUEUE_RING_SIZE - 1),
+    m_enqueuePos(0),
+    m_dequeuePos(0),
+    m_waiting(false),
+    m_hasOverflow(false),
+    m_ringFullDropCount(0),
+    m_overflowCount(0),
+    m_queueSize(0),
     m_queueSizeLimit(queueLimit),
-    m_dropCount(0)
+    m_dropCount(0),
+    m_coalesceCount(0)
 {
     SWSS_LOG_ENTER();
 
-    // empty;
+    m_ring = std::unique_ptr<Cell[]>(new Cell[NOTIFICATION_QUEUE_RING_SIZE]);
+
+    // cell sequence equal to position means cell is free for producer at
+    // that position, position + 1 means it holds item for consumer
+
+    for (uint64_t idx = 0; idx < NOTIFICATION_QUEUE_RING_SIZE; idx++)
+    {
+        m_ring[idx].m_sequence.store(idx, std::memory_order_relaxed);
+    }
+
+    m_select.addSelectable(&m_event);
 }
 
 NotificationQueue::~NotificationQueue()
@@ -24,49 +47,427 @@ NotificationQueue::~NotificationQueue()
     // empty
 }
 
-bool NotificationQueue::enqueue(
+NotificationQueuePolicy NotificationQueue::getPolicy(
+        _In_ const std::string& notification)
+{
+    SWSS_LOG_ENTER();
+
+    if (notification == OTAI_LINECARD_NOTIFICATION_NAME_LINECARD_ALARM_NOTIFY ||
+        notification == OTAI_APS_NOTIFICATION_NAME_OLP_SWITCH_NOTIFY ||
+        notification == NOTIFICATION_QUEUE_CURRENT_ALARMS_FLUSH)
+    {
+        return NOTIFICATION_QUEUE_POLICY_KEEP;
+    }
+
+    if (notification == OTAI_LINECARD_NOTIFICATION_NAME_LINECARD_STATE_CHANGE ||
+        notification == OTAI_OCM_NOTIFICATION_NAME_SPECTRUM_POWER_NOTIFY)
+    {
+        return NOTIFICATION_QUEUE_POLICY_COALESCE;
+    }
+
+    return NOTIFICATION_QUEUE_POLICY_DROP_OLDEST;
+}
+
+/*
+ * Coalesced notifications carry object id as string field of json data,
+ * field is looked up without parsing whole json, since OCM notification
+ * contains whole spectrum.
+ */
+std::string NotificationQueue::getCoalesceKey(
         _In_ const swss::KeyOpFieldsValuesTuple& item)
 {
-    MUTEX;
+    SWSS_LOG_ENTER();
+
+    auto& notification = kfvKey(item);
+    auto& data = kfvOp(item);
+
+    std::string field = (notification == OTAI_OCM_NOTIFICATION_NAME_SPECTRUM_POWER_NOTIFY)
+        ? "\"ocm_id\":\""
+        : "\"linecard_id\":\"";
+
+    auto start = data.find(field);
+
+    if (start == std::string::npos)
+    {
+        return notification;
+    }
+
+    start += field.size();
+
+    auto end = data.find('"', start);
+
+    if (end == std::string::npos)
+    {
+        return notification;
+    }
+
+    return notification + "|" + data.substr(start, end - start);
+}
+
+void NotificationQueue::drop(
+        _In_ const std::string& notification)
+{
+    SWSS_LOG_ENTER();
+
+    m_dropCount++;
+    m_dropCounts[notification]++;
 
+    if (m_dropCount % NOTIFICATION_QUEUE_DROP_COUNT_INDICATOR == 1)
+    {
+        SWSS_LOG_WARN("notification queue is full (limit %zu), %zu notifications dropped so far, last %s",
+                m_queueSizeLimit,
+                m_dropCount,
+                notification.c_str());
+    }
+}
+
+bool NotificationQueue::enqueue(
+        _In_ const swss::KeyOpFieldsValuesTuple& item)
+{
     SWSS_LOG_ENTER();
 
-    /*
-     * If the queue exceeds the limit, then drop all further FDB events This is
-     * a temporary solution to handle high memory usage by syncd and the
-     * notification queue keeps growing. The permanent solution would be to
-     * make this stateful so that only the *latest* event is published.
-     */
+    uint64_t pos = 0;
+
+    Cell* cell = nullptr;
+
+    // while overflow list is not empty ring is treated as full, otherwise
+    // later notifications would be dequeued before those in overflow list
+
+    if (!m_hasOverflow.load())
+    {
+        pos = m_enqueuePos.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            cell = &m_ring[pos & m_ringMask];
+
+            uint64_t seq = cell->m_sequence.load(std::memory_order_acquire);
 
-    m_queue.push(item);
+            int64_t diff = (int64_t)(seq - pos);
+
+            if (diff == 0)
+            {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // ring is full, consumer is behind
+
+                cell = nullptr;
+                break;
+            }
+            else
+            {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    if (cell)
+    {
+        cell->m_item = item;
+
+        cell->m_sequence.store(pos + 1, std::memory_order_release);
+    }
+    else if (getPolicy(kfvKey(item)) == NOTIFICATION_QUEUE_POLICY_DROP_OLDEST)
+    {
+        m_ringFullDropCount++;
+
+        return false;
+    }
+    else
+    {
+        std::lock_guard<std::mutex> _lock(m_overflowMutex);
+
+        m_overflow.push_back(item);
+
+        m_overflowCount++;
+
+        m_hasOverflow = true;
+    }
+
+    // pairs with fence in wait, either consumer sees this item or we see
+    // consumer is waiting
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (m_waiting.load(std::memory_order_relaxed) && m_waiting.exchange(false))
+    {
+        m_event.notify();
+    }
 
     return true;
 }
 
-bool NotificationQueue::tryDequeue(
+bool NotificationQueue::tryPopRing(
         _Out_ swss::KeyOpFieldsValuesTuple& item)
 {
-    MUTEX;
-
     SWSS_LOG_ENTER();
 
-    if (m_queue.empty())
+    uint64_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+
+    Cell& cell = m_ring[pos & m_ringMask];
+
+    if (cell.m_sequence.load(std::memory_order_acquire) != pos + 1)
     {
         return false;
     }
 
-    item = m_queue.front();
+    item = std::move(cell.m_item);
+
+    cell.m_item = swss::KeyOpFieldsValuesTuple();
 
-    m_queue.pop();
+    cell.m_sequence.store(pos + NOTIFICATION_QUEUE_RING_SIZE, std::memory_order_release);
+
+    m_dequeuePos.store(pos + 1, std::memory_order_relaxed);
 
     return true;
 }
 
+bool NotificationQueue::isEmpty()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_hasOverflow.load())
+    {
+        return false;
+    }
+
+    uint64_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+
+    return m_ring[pos & m_ringMask].m_sequence.load(std::memory_order_acquire) != pos + 1;
+}
+
+void NotificationQueue::drain()
+{
+    SWSS_LOG_ENTER();
+
+    swss::KeyOpFieldsValuesTuple item;
+
+    while (tryPopRing(item))
+    {
+        push(std::move(item));
+    }
+
+    if (!m_hasOverflow.load())
+    {
+        return;
+    }
+
+    std::vector<swss::KeyOpFieldsValuesTuple> overflow;
+
+    uint64_t end = 0;
+
+    {
+        std::lock_guard<std::mutex> _lock(m_overflowMutex);
+
+        overflow.swap(m_overflow);
+
+        // producers don't use ring while overflow flag is set, so ring
+        // positions up to here were taken before overflow list items
+
+        end = m_enqueuePos.load();
+
+        m_hasOverflow = false;
+    }
+
+    // position may be taken by producer which is still writing item
+
+    while (m_dequeuePos.load(std::memory_order_relaxed) < end)
+    {
+        if (tryPopRing(item))
+        {
+            push(std::move(item));
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto& i: overflow)
+    {
+        push(std::move(i));
+    }
+}
+
+void NotificationQueue::push(
+        _In_ swss::KeyOpFieldsValuesTuple&& item)
+{
+    SWSS_LOG_ENTER();
+
+    auto notification = kfvKey(item);
+
+    auto policy = getPolicy(notification);
+
+    if (policy == NOTIFICATION_QUEUE_POLICY_COALESCE)
+    {
+        auto key = getCoalesceKey(item);
+
+        auto it = m_coalesced.find(key);
+
+        if (it != m_coalesced.end())
+        {
+            it->second->m_item = std::move(item);
+
+            m_coalesceCount++;
+            m_coalesceCounts[notification]++;
+
+            return;
+        }
+
+        m_queue.push_back({ std::move(item), policy, key });
+
+        m_coalesced[key] = std::prev(m_queue.end());
+
+        m_queueSize = m_queue.size();
+
+        return;
+    }
+
+    if (policy == NOTIFICATION_QUEUE_POLICY_DROP_OLDEST && m_queue.size() >= m_queueSizeLimit)
+    {
+        if (m_droppable.empty())
+        {
+            // queue is full of notifications which can't be dropped
+
+            drop(notification);
+
+            return;
+        }
+
+        auto oldest = m_droppable.front();
+
+        m_droppable.pop_front();
+
+        drop(kfvKey(oldest->m_item));
+
+        m_queue.erase(oldest);
+    }
+
+    m_queue.push_back({ std::move(item), policy, "" });
+
+    if (policy == NOTIFICATION_QUEUE_POLICY_DROP_OLDEST)
+    {
+        m_droppable.push_back(std::prev(m_queue.end()));
+    }
+
+    m_queueSize = m_queue.size();
+}
+
+size_t NotificationQueue::dequeueBatch(
+        _Inout_ std::vector<swss::KeyOpFieldsValuesTuple>& items,
+        _In_ size_t maxCount)
+{
+    SWSS_LOG_ENTER();
+
+    drain();
+
+    size_t count = 0;
+
+    while (count < maxCount && !m_queue.empty())
+    {
+        auto& entry = m_queue.front();
+
+        // droppable notifications are queued in same order as in
+        // m_droppable, so first queued droppable notification is also first
+        // there
+
+        if (entry.m_policy == NOTIFICATION_QUEUE_POLICY_DROP_OLDEST)
+        {
+            m_droppable.pop_front();
+        }
+        else if (entry.m_policy == NOTIFICATION_QUEUE_POLICY_COALESCE)
+        {
+            m_coalesced.erase(entry.m_coalesceKey);
+        }
+
+        items.push_back(std::move(entry.m_item));
+
+        m_queue.pop_front();
+
+        count++;
+    }
+
+    m_queueSize = m_queue.size();
+
+    return count;
+}
+
+void NotificationQueue::wait(
+        _In_ int timeoutMs)
+{
+    SWSS_LOG_ENTER();
+
+    m_waiting = true;
+
+    // pairs with fence in enqueue
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (!isEmpty() || !m_queue.empty())
+    {
+        m_waiting = false;
+        return;
+    }
+
+    swss::Selectable *sel = nullptr;
+
+    m_select.select(&sel, timeoutMs);
+
+    m_waiting = false;
+}
+
+void NotificationQueue::signal()
+{
+    SWSS_LOG_ENTER();
+
+    m_event.notify();
+}
+
 size_t NotificationQueue::getQueueSize()
 {
-    MUTEX;
+    SWSS_LOG_ENTER();
+
+    uint64_t ring = m_enqueuePos.load(std::memory_order_relaxed) - m_dequeuePos.load(std::memory_order_relaxed);
+
+    return m_queueSize.load() + (size_t)ring;
+}
+
+std::vector<swss::FieldValueTuple> NotificationQueue::getStatistics()
+{
+    SWSS_LOG_ENTER();
 
+    std::vector<swss::FieldValueTuple> values;
+
+    uint64_t ringFullDropCount = m_ringFullDropCount.load();
+
+    values.emplace_back("queue-size", otai_serialize_number(getQueueSize()));
+    values.emplace_back("queue-size-limit", otai_serialize_number(m_queueSizeLimit));
+    values.emplace_back("drop-count", otai_serialize_number(m_dropCount + ringFullDropCount));
+    values.emplace_back("coalesce-count", otai_serialize_number(m_coalesceCount));
+    values.emplace_back("ring-full-drop-count", otai_serialize_number(ringFullDropCount));
+    values.emplace_back("overflow-count", otai_serialize_number(m_overflowCount.load()));
+
+    for (auto& kvp: m_dropCounts)
+    {
+        values.emplace_back(kvp.first + "-drop-count", otai_serialize_number(kvp.second));
+    }
+
+    for (auto& kvp: m_coalesceCounts)
+    {
+        values.emplace_back(kvp.first + "-coalesce-count", otai_serialize_number(kvp.second));
+    }
+
+    return values;
+}
+
+uint64_t NotificationQueue::getStatisticsVersion()
+{
     SWSS_LOG_ENTER();
 
-    return m_queue.size();
+    return m_dropCount + m_coalesceCount + m_ringFullDropCount.load() + m_overflowCount.load();
 }
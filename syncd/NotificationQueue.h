@@ -5,24 +5,106 @@ extern "C" {
 }
 
 #include "swss/table.h"
+#include "swss/select.h"
+#include "swss/selectableevent.h"
 
-#include <queue>
+#include <list>
+#include <deque>
+#include <map>
+#include <unordered_map>
 #include <mutex>
+#include <atomic>
+#include <memory>
 
 /**
  * @brief Default notification queue size limit.
  *
- * Value based on typical L2 deployment with 256k MAC entries and
- * some extra buffer for other events like port-state, q-deadlock etc
+ * Limit applies only to notifications which can be dropped, alarms and APS
+ * switch events are always queued and coalesced notifications are bounded
+ * by number of objects. OTDR results carry whole trace, so limit is kept
+ * low.
+ */
+#define DEFAULT_NOTIFICATION_QUEUE_SIZE_LIMIT (10000)
+
+/**
+ * @brief Number of slots in lock free ring between vendor callbacks and
+ * notification processing thread, must be power of 2.
+ */
+#define NOTIFICATION_QUEUE_RING_SIZE (8192)
+
+/**
+ * @brief Internal notification which removes current alarms of linecard,
+ * enqueued when linecard becomes inactive, data is linecard RID.
  *
- * TODO: move to config, also this limit only applies to fdb notifications
+ * It goes through queue, so it's applied in order with alarm notifications
+ * and on processing thread, which owns current alarms.
  */
-#define DEFAULT_NOTIFICATION_QUEUE_SIZE_LIMIT (300000)
+#define NOTIFICATION_QUEUE_CURRENT_ALARMS_FLUSH "current_alarms_flush"
 
 namespace syncd
 {
+    typedef enum _NotificationQueuePolicy
+    {
+        /**
+         * @brief Notification is never dropped.
+         */
+        NOTIFICATION_QUEUE_POLICY_KEEP,
+
+        /**
+         * @brief Only latest notification per object is kept.
+         *
+         * Queued notification is replaced in place, so it keeps its position
+         * in queue.
+         */
+        NOTIFICATION_QUEUE_POLICY_COALESCE,
+
+        /**
+         * @brief Oldest notification of this policy is dropped when queue is
+         * full.
+         */
+        NOTIFICATION_QUEUE_POLICY_DROP_OLDEST,
+
+    } NotificationQueuePolicy;
+
+    /**
+     * @brief Multiple producer, single consumer notification queue.
+     *
+     * Vendor callbacks enqueue into bounded lock free ring, so enqueue never
+     * waits for processing thread. Processing thread moves notifications from
+     * ring to pending queue where drop and coalesce policies are applied, and
+     * dequeues them in batches. Consumer is woken up by eventfd, only when it
+     * is waiting.
+     *
+     * When ring is full, droppable notifications are dropped and others are
+     * put to overflow list, which is guarded by mutex held by consumer only
+     * for swap. Until consumer takes overflow list, ring is treated as full,
+     * so notifications are dequeued in order in which they were enqueued.
+     *
+     * Only enqueue, signal and getQueueSize can be called from producer
+     * threads, all other methods are consumer side.
+     */
     class NotificationQueue
     {
+        private:
+
+            typedef struct _Entry
+            {
+                swss::KeyOpFieldsValuesTuple m_item;
+
+                NotificationQueuePolicy m_policy;
+
+                std::string m_coalesceKey;
+
+            } Entry;
+
+            typedef struct _Cell
+            {
+                std::atomic<uint64_t> m_sequence;
+
+                swss::KeyOpFieldsValuesTuple m_item;
+
+            } Cell;
+
         public:
 
             NotificationQueue(
@@ -32,22 +114,135 @@ namespace syncd
 
         public:
 
+            /**
+             * @brief Enqueue notification and wake up consumer.
+             *
+             * Returns false when notification was dropped because ring is
+             * full.
+             */
             bool enqueue(
                     _In_ const swss::KeyOpFieldsValuesTuple& msg);
 
-            bool tryDequeue(
-                    _Out_ swss::KeyOpFieldsValuesTuple& msg);
-
+            /**
+             * @brief Dequeue at most maxCount notifications.
+             *
+             * Returns number of dequeued notifications.
+             */
+            size_t dequeueBatch(
+                    _Inout_ std::vector<swss::KeyOpFieldsValuesTuple>& items,
+                    _In_ size_t maxCount);
+
+            /**
+             * @brief Wait until notification is enqueued, signal is called or
+             * timeout expires.
+             */
+            void wait(
+                    _In_ int timeoutMs);
+
+            /**
+             * @brief Wake up consumer.
+             */
+            void signal();
+
+            /**
+             * @brief Get approximate number of queued notifications.
+             */
             size_t getQueueSize();
 
+            /**
+             * @brief Get queue size, total and per notification drop and
+             * coalesce counters.
+             */
+            std::vector<swss::FieldValueTuple> getStatistics();
+
+            /**
+             * @brief Get value which changes each time notification is
+             * dropped, coalesced or put to overflow list.
+             */
+            uint64_t getStatisticsVersion();
+
+        public:
+
+            static NotificationQueuePolicy getPolicy(
+                    _In_ const std::string& notification);
+
+        private:
+
+            static std::string getCoalesceKey(
+                    _In_ const swss::KeyOpFieldsValuesTuple& item);
+
+            bool tryPopRing(
+                    _Out_ swss::KeyOpFieldsValuesTuple& item);
+
+            bool isEmpty();
+
+            /**
+             * @brief Move notifications from ring and overflow list to
+             * pending queue.
+             */
+            void drain();
+
+            /**
+             * @brief Put notification to pending queue according to its
+             * policy.
+             */
+            void push(
+                    _In_ swss::KeyOpFieldsValuesTuple&& item);
+
+            void drop(
+                    _In_ const std::string& notification);
+
         private:
 
-            std::mutex m_mutex;
+            std::unique_ptr<Cell[]> m_ring;
+
+            uint64_t m_ringMask;
+
+            std::atomic<uint64_t> m_enqueuePos;
+
+            std::atomic<uint64_t> m_dequeuePos;
+
+            std::atomic<bool> m_waiting;
+
+            swss::SelectableEvent m_event;
+
+            swss::Select m_select;
 
-            std::queue<swss::KeyOpFieldsValuesTuple> m_queue;
+            std::mutex m_overflowMutex;
+
+            std::vector<swss::KeyOpFieldsValuesTuple> m_overflow;
+
+            std::atomic<bool> m_hasOverflow;
+
+            std::atomic<uint64_t> m_ringFullDropCount;
+
+            std::atomic<uint64_t> m_overflowCount;
+
+        private: // consumer side
+
+            std::list<Entry> m_queue;
+
+            std::atomic<size_t> m_queueSize;
+
+            /**
+             * @brief Queued coalesced notifications by notification and
+             * object.
+             */
+            std::unordered_map<std::string, std::list<Entry>::iterator> m_coalesced;
+
+            /**
+             * @brief Queued droppable notifications, oldest first.
+             */
+            std::deque<std::list<Entry>::iterator> m_droppable;
 
             size_t m_queueSizeLimit;
 
             size_t m_dropCount;
+
+            size_t m_coalesceCount;
+
+            std::map<std::string, uint64_t> m_dropCounts;
+
+            std::map<std::string, uint64_t> m_coalesceCounts;
     };
 }
@@ -0,0 +1,95 @@
+#include "OcmSpectrum.h"
+#include "BinaryPacking.h"
+#include "RedisClient.h"
+
+#include "otairediscommon.h"
+
+#include "swss/logger.h"
+
+using namespace syncd;
+
+#define OCM_SPECTRUM_ENTRY_SIZE (2 * sizeof(uint64_t) + sizeof(double))
+
+std::string OcmSpectrum::pack(
+        _In_ const otai_spectrum_power_list_t& list)
+{
+    SWSS_LOG_ENTER();
+
+    std::string data;
+
+    data.reserve(list.count * OCM_SPECTRUM_ENTRY_SIZE);
+
+    for (uint32_t i = 0; i < list.count; i++)
+    {
+        BinaryPacking::packUint64(data, list.list[i].lower_frequency);
+        BinaryPacking::packUint64(data, list.list[i].upper_frequency);
+        BinaryPacking::packDouble(data, (double)list.list[i].power);
+    }
+
+    return data;
+}
+
+std::vector<OcmSpectrumEntry> OcmSpectrum::unpack(
+        _In_ const std::string& data)
+{
+    SWSS_LOG_ENTER();
+
+    if (data.size() % OCM_SPECTRUM_ENTRY_SIZE)
+    {
+        SWSS_LOG_THROW("invalid packed OCM spectrum size %zu", data.size());
+    }
+
+    std::vector<OcmSpectrumEntry> entries(data.size() / OCM_SPECTRUM_ENTRY_SIZE);
+
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        size_t offset = i * OCM_SPECTRUM_ENTRY_SIZE;
+
+        entries[i].m_lowerFrequency = BinaryPacking::unpackUint64(data, offset);
+        entries[i].m_upperFrequency = BinaryPacking::unpackUint64(data, offset + sizeof(uint64_t));
+        entries[i].m_power = BinaryPacking::unpackDouble(data, offset + 2 * sizeof(uint64_t));
+    }
+
+    return entries;
+}
+
+std::vector<OcmSpectrumEntry> OcmSpectrum::read(
+        _In_ swss::DBConnector& stateDb,
+        _In_ const std::string& ocmName)
+{
+    SWSS_LOG_ENTER();
+
+    std::string key = STATE_OT_OCM_TABLE_NAME "|" + ocmName + "|" OCM_SPECTRUM_KEY_SUFFIX;
+
+    // data is read from raw reply with its length, packed spectrum contains
+    // zero bytes
+
+    auto values = RedisClient::pipelineHgetall(stateDb, { key }).front();
+
+    const std::string* encoding = nullptr;
+    const std::string* data = nullptr;
+
+    for (auto& fv: values)
+    {
+        if (fvField(fv) == OCM_SPECTRUM_FIELD_ENCODING)
+        {
+            encoding = &fvValue(fv);
+        }
+        else if (fvField(fv) == OCM_SPECTRUM_FIELD_DATA)
+        {
+            data = &fvValue(fv);
+        }
+    }
+
+    if (encoding == nullptr || data == nullptr)
+    {
+        return {};
+    }
+
+    if (*encoding != OCM_SPECTRUM_ENCODING)
+    {
+        SWSS_LOG_THROW("unsupported OCM spectrum encoding %s", encoding->c_str());
+    }
+
+    return unpack(*data);
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+extern "C" {
+#include "otai.h"
+}
+
+#include "swss/dbconnector.h"
+
+#include <string>
+#include <vector>
+
+/*
+ * Key suffix and field values of compact OCM spectrum entry in STATE DB OCM
+ * table, key is "<ocm name>|SPECTRUM".
+ */
+#define OCM_SPECTRUM_KEY_SUFFIX     "SPECTRUM"
+#define OCM_SPECTRUM_ENCODING       "packed-v1"
+#define OCM_SPECTRUM_FIELD_ENCODING "encoding"
+#define OCM_SPECTRUM_FIELD_COUNT    "count"
+#define OCM_SPECTRUM_FIELD_DATA     "data"
+
+namespace syncd
+{
+    typedef struct _OcmSpectrumEntry
+    {
+        uint64_t m_lowerFrequency;
+
+        uint64_t m_upperFrequency;
+
+        double m_power;
+
+    } OcmSpectrumEntry;
+
+    /**
+     * @brief Compact encoding of OCM spectrum.
+     *
+     * Whole scan is stored as single binary value, each channel is packed as
+     * lower frequency (uint64), upper frequency (uint64) and power (IEEE 754
+     * double), all little endian, 24 bytes per channel.
+     */
+    class OcmSpectrum
+    {
+        private:
+
+            OcmSpectrum() = delete;
+
+            ~OcmSpectrum() = delete;
+
+        public:
+
+            static std::string pack(
+                    _In_ const otai_spectrum_power_list_t& list);
+
+            /**
+             * @brief Unpack spectrum packed by pack().
+             *
+             * Throws when data size is not multiple of entry size.
+             */
+            static std::vector<OcmSpectrumEntry> unpack(
+                    _In_ const std::string& data);
+
+            /**
+             * @brief Read compact spectrum of given OCM from STATE DB.
+             *
+             * Returns empty vector when spectrum is not present or expired.
+             */
+            static std::vector<OcmSpectrumEntry> read(
+                    _In_ swss::DBConnector& stateDb,
+                    _In_ const std::string& ocmName);
+    };
+}
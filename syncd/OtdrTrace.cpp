@@ -0,0 +1,215 @@
+#include "OtdrTrace.h"
+#include "BinaryPacking.h"
+#include "RedisClient.h"
+
+#include "meta/otai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <zstd.h>
+
+using namespace syncd;
+
+#define OTDR_EVENT_ENTRY_SIZE (sizeof(uint32_t) + 4 * sizeof(double))
+
+/*
+ * Traces are compressed on notification thread for every scan, fastest
+ * level already gives most of the gain on OTDR traces.
+ */
+#define OTDR_TRACE_ZSTD_LEVEL 1
+
+bool OtdrTrace::isEncodingSupported(
+        _In_ const std::string& encoding)
+{
+    SWSS_LOG_ENTER();
+
+    return encoding == OTDR_TRACE_ENCODING_TEXT ||
+        encoding == OTDR_TRACE_ENCODING_RAW ||
+        encoding == OTDR_TRACE_ENCODING_ZSTD;
+}
+
+std::string OtdrTrace::encodeTrace(
+        _In_ const std::string& trace,
+        _In_ const std::string& encoding)
+{
+    SWSS_LOG_ENTER();
+
+    if (encoding == OTDR_TRACE_ENCODING_TEXT)
+    {
+        return otai_serialize_hex_binary(trace.data(), trace.size());
+    }
+
+    if (encoding == OTDR_TRACE_ENCODING_RAW)
+    {
+        return trace;
+    }
+
+    if (encoding != OTDR_TRACE_ENCODING_ZSTD)
+    {
+        SWSS_LOG_THROW("unsupported OTDR trace encoding %s", encoding.c_str());
+    }
+
+    std::string data(ZSTD_compressBound(trace.size()), '\0');
+
+    size_t size = ZSTD_compress(&data[0], data.size(), trace.data(), trace.size(), OTDR_TRACE_ZSTD_LEVEL);
+
+    if (ZSTD_isError(size))
+    {
+        SWSS_LOG_THROW("failed to compress OTDR trace: %s", ZSTD_getErrorName(size));
+    }
+
+    data.resize(size);
+
+    return data;
+}
+
+std::string OtdrTrace::decodeTrace(
+        _In_ const std::string& data,
+        _In_ const std::string& encoding,
+        _In_ size_t traceSize)
+{
+    SWSS_LOG_ENTER();
+
+    if (encoding == OTDR_TRACE_ENCODING_TEXT)
+    {
+        std::string trace(data.size() / 2, '\0');
+
+        otai_deserialize_hex_binary(data, &trace[0], trace.size());
+
+        return trace;
+    }
+
+    if (encoding == OTDR_TRACE_ENCODING_RAW)
+    {
+        return data;
+    }
+
+    if (encoding != OTDR_TRACE_ENCODING_ZSTD)
+    {
+        SWSS_LOG_THROW("unsupported OTDR trace encoding %s", encoding.c_str());
+    }
+
+    std::string trace(traceSize, '\0');
+
+    size_t size = ZSTD_decompress(&trace[0], trace.size(), data.data(), data.size());
+
+    if (ZSTD_isError(size) || size != traceSize)
+    {
+        SWSS_LOG_THROW("failed to decompress OTDR trace of size %zu", traceSize);
+    }
+
+    return trace;
+}
+
+std::string OtdrTrace::packEvents(
+        _In_ const otai_otdr_event_list_t& events)
+{
+    SWSS_LOG_ENTER();
+
+    std::string data;
+
+    data.reserve(events.count * OTDR_EVENT_ENTRY_SIZE);
+
+    for (uint32_t i = 0; i < events.count; i++)
+    {
+        auto& e = events.list[i];
+
+        BinaryPacking::packUint32(data, (uint32_t)e.type);
+        BinaryPacking::packDouble(data, (double)e.length);
+        BinaryPacking::packDouble(data, (double)e.loss);
+        BinaryPacking::packDouble(data, (double)e.reflection);
+        BinaryPacking::packDouble(data, (double)e.accumulate_loss);
+    }
+
+    return data;
+}
+
+std::vector<OtdrEventEntry> OtdrTrace::unpackEvents(
+        _In_ const std::string& data)
+{
+    SWSS_LOG_ENTER();
+
+    if (data.size() % OTDR_EVENT_ENTRY_SIZE)
+    {
+        SWSS_LOG_THROW("invalid packed OTDR events size %zu", data.size());
+    }
+
+    std::vector<OtdrEventEntry> events(data.size() / OTDR_EVENT_ENTRY_SIZE);
+
+    for (size_t i = 0; i < events.size(); i++)
+    {
+        size_t offset = i * OTDR_EVENT_ENTRY_SIZE;
+
+        events[i].m_type = BinaryPacking::unpackUint32(data, offset);
+
+        offset += sizeof(uint32_t);
+
+        events[i].m_length = BinaryPacking::unpackDouble(data, offset);
+        events[i].m_loss = BinaryPacking::unpackDouble(data, offset + sizeof(double));
+        events[i].m_reflection = BinaryPacking::unpackDouble(data, offset + 2 * sizeof(double));
+        events[i].m_accumulateLoss = BinaryPacking::unpackDouble(data, offset + 3 * sizeof(double));
+    }
+
+    return events;
+}
+
+bool OtdrTrace::read(
+        _In_ swss::DBConnector& db,
+        _In_ const std::string& key,
+        _Out_ OtdrScan& scan)
+{
+    SWSS_LOG_ENTER();
+
+    // values are read from raw reply with their length, trace and events
+    // contain zero bytes
+
+    auto values = RedisClient::pipelineHgetall(db, { key }).front();
+
+    if (values.empty())
+    {
+        return false;
+    }
+
+    scan.m_metadata.clear();
+    scan.m_trace.clear();
+    scan.m_events.clear();
+
+    std::string data;
+
+    for (auto& fv: values)
+    {
+        if (fvField(fv) == OTDR_FIELD_DATA)
+        {
+            data = fvValue(fv);
+        }
+        else if (fvField(fv) == OTDR_FIELD_EVENTS)
+        {
+            scan.m_events = unpackEvents(fvValue(fv));
+        }
+        else
+        {
+            scan.m_metadata[fvField(fv)] = fvValue(fv);
+        }
+    }
+
+    auto encoding = scan.m_metadata.find(OTDR_FIELD_DATA_ENCODING);
+    auto size = scan.m_metadata.find(OTDR_FIELD_DATA_SIZE);
+
+    if (encoding == scan.m_metadata.end())
+    {
+        // text encoded entry has no encoding and size fields
+
+        scan.m_trace = decodeTrace(data, OTDR_TRACE_ENCODING_TEXT, data.size() / 2);
+
+        return true;
+    }
+
+    if (size == scan.m_metadata.end())
+    {
+        SWSS_LOG_THROW("OTDR entry %s has no trace size", key.c_str());
+    }
+
+    scan.m_trace = decodeTrace(data, encoding->second, std::stoull(size->second));
+
+    return true;
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+extern "C" {
+#include "otai.h"
+}
+
+#include "swss/dbconnector.h"
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+/*
+ * Trace encodings. Text is the layout stored before binary blobs, trace as
+ * hex string and each event in own OTDR_EVENT key, entry has no
+ * "data-encoding" field. Raw and zstd are binary blobs, stored in
+ * "data-encoding" field of OTDR entry.
+ */
+#define OTDR_TRACE_ENCODING_TEXT "text"
+#define OTDR_TRACE_ENCODING_RAW  "raw"
+#define OTDR_TRACE_ENCODING_ZSTD "zstd"
+
+#define OTDR_FIELD_DATA          "data"
+#define OTDR_FIELD_DATA_ENCODING "data-encoding"
+#define OTDR_FIELD_DATA_SIZE     "data-size"
+#define OTDR_FIELD_EVENTS        "events"
+#define OTDR_FIELD_EVENT_COUNT   "event-count"
+
+namespace syncd
+{
+    typedef struct _OtdrEventEntry
+    {
+        uint32_t m_type;
+
+        double m_length;
+
+        double m_loss;
+
+        double m_reflection;
+
+        double m_accumulateLoss;
+
+    } OtdrEventEntry;
+
+    typedef struct _OtdrScan
+    {
+        /**
+         * @brief Scan metadata, all fields except data and events.
+         */
+        std::unordered_map<std::string, std::string> m_metadata;
+
+        /**
+         * @brief Decoded trace data.
+         */
+        std::string m_trace;
+
+        std::vector<OtdrEventEntry> m_events;
+
+    } OtdrScan;
+
+    /**
+     * @brief OTDR scan storage encoding.
+     *
+     * With binary encodings trace is stored as blob, either raw or compressed
+     * by zstd, with its uncompressed size. Events are stored as single packed
+     * array, each event is type (uint32) followed by length, loss, reflection
+     * and accumulated loss (IEEE 754 double), all little endian.
+     */
+    class OtdrTrace
+    {
+        private:
+
+            OtdrTrace() = delete;
+
+            ~OtdrTrace() = delete;
+
+        public:
+
+            static bool isEncodingSupported(
+                    _In_ const std::string& encoding);
+
+            static std::string encodeTrace(
+                    _In_ const std::string& trace,
+                    _In_ const std::string& encoding);
+
+            static std::string decodeTrace(
+                    _In_ const std::string& data,
+                    _In_ const std::string& encoding,
+                    _In_ size_t traceSize);
+
+            static std::string packEvents(
+                    _In_ const otai_otdr_event_list_t& events);
+
+            static std::vector<OtdrEventEntry> unpackEvents(
+                    _In_ const std::string& data);
+
+            /**
+             * @brief Read and decode OTDR scan stored by syncd.
+             *
+             * Key is whole redis key, as returned by OTDR history index.
+             * Returns false when key doesn't exist. Events of text encoded
+             * scan are in OTDR_EVENT keys and are not read.
+             */
+            static bool read(
+                    _In_ swss::DBConnector& db,
+                    _In_ const std::string& key,
+                    _Out_ OtdrScan& scan);
+    };
+}
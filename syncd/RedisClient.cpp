@@ -7,6 +7,11 @@
 
 #include "swss/logger.h"
 #include "swss/redisapi.h"
+#include "swss/rediscommand.h"
+#include "swss/redisreply.h"
+
+#include <algorithm>
+#include <cstring>
 
 using namespace syncd;
 
@@ -16,6 +21,332 @@ using namespace syncd;
 #define HIDDEN                      "HIDDEN"
 #define COLDVIDS                    "COLDVIDS"
 
+#define ASIC_STATE_INDEX            "ASIC_STATE_INDEX"
+#define FLEX_COUNTER_INDEX          "FLEX_COUNTER_TABLE_INDEX"
+#define FLEX_COUNTER_GROUP_INDEX    "FLEX_COUNTER_GROUP_TABLE_INDEX"
+
+/*
+ * Maximum number of fields in single HMSET/HDEL command, large maps are
+ * split into multiple commands inside the same transaction.
+ */
+#define REDIS_CLIENT_MAX_FIELDS_PER_COMMAND 1024
+
+/*
+ * Maximum number of commands sent in single pipeline before reading replies.
+ */
+#define REDIS_CLIENT_PIPELINE_BATCH_SIZE 1024
+
+/*
+ * Bucket is first key element after table name, for ASIC state this is object
+ * type and for flex counter table this is group name.
+ */
+static std::string getTableKeyBucket(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    auto start = key.find_first_of(":");
+
+    if (start == std::string::npos)
+    {
+        return key;
+    }
+
+    auto end = key.find_first_of(":", start + 1);
+
+    return key.substr(start + 1, end == std::string::npos ? std::string::npos : end - start - 1);
+}
+
+static std::string getSingleBucket(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    return "ALL";
+}
+
+/*
+ * HGETALL commands are pipelined in batches, so many hashes are loaded with
+ * few round trips instead of one per key.
+ */
+std::vector<std::vector<swss::FieldValueTuple>> RedisClient::pipelineHgetall(
+        _In_ swss::DBConnector& db,
+        _In_ const std::vector<std::string>& keys)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::vector<swss::FieldValueTuple>> values(keys.size());
+
+    redisContext* ctx = db.getContext();
+
+    for (size_t idx = 0; idx < keys.size(); idx += REDIS_CLIENT_PIPELINE_BATCH_SIZE)
+    {
+        size_t end = std::min(keys.size(), idx + REDIS_CLIENT_PIPELINE_BATCH_SIZE);
+
+        for (size_t i = idx; i < end; i++)
+        {
+            swss::RedisCommand cmd;
+
+            cmd.format("HGETALL %s", keys[i].c_str());
+
+            if (redisAppendFormattedCommand(ctx, cmd.c_str(), cmd.length()) != REDIS_OK)
+            {
+                SWSS_LOG_THROW("failed to append HGETALL %s to pipeline: %s", keys[i].c_str(), ctx->errstr);
+            }
+        }
+
+        for (size_t i = idx; i < end; i++)
+        {
+            redisReply* reply = NULL;
+
+            if (redisGetReply(ctx, (void**)&reply) != REDIS_OK)
+            {
+                SWSS_LOG_THROW("failed to get HGETALL %s reply: %s", keys[i].c_str(), ctx->errstr);
+            }
+
+            swss::RedisReply r(reply);
+
+            r.checkReplyType(REDIS_REPLY_ARRAY);
+
+            auto& fvs = values[i];
+
+            fvs.reserve(reply->elements / 2);
+
+            for (size_t j = 0; j + 1 < reply->elements; j += 2)
+            {
+                fvs.emplace_back(
+                        std::string(reply->element[j]->str, reply->element[j]->len),
+                        std::string(reply->element[j + 1]->str, reply->element[j + 1]->len));
+            }
+        }
+    }
+
+    return values;
+}
+
+/*
+ * Commands are wrapped in MULTI/EXEC and written in single pipeline, so
+ * transaction takes one round trip. All replies are read before error is
+ * reported, so connection stays usable.
+ */
+void RedisClient::pipelineTransaction(
+        _In_ swss::DBConnector& db,
+        _In_ const std::vector<std::string>& commands)
+{
+    SWSS_LOG_ENTER();
+
+    if (commands.empty())
+    {
+        return;
+    }
+
+    redisContext* ctx = db.getContext();
+
+    swss::RedisCommand multi;
+    swss::RedisCommand exec;
+
+    multi.format("MULTI");
+    exec.format("EXEC");
+
+    if (redisAppendFormattedCommand(ctx, multi.c_str(), multi.length()) != REDIS_OK)
+    {
+        SWSS_LOG_THROW("failed to append MULTI to pipeline: %s", ctx->errstr);
+    }
+
+    for (auto& cmd: commands)
+    {
+        if (redisAppendFormattedCommand(ctx, cmd.data(), cmd.size()) != REDIS_OK)
+        {
+            SWSS_LOG_THROW("failed to append command to pipeline: %s", ctx->errstr);
+        }
+    }
+
+    if (redisAppendFormattedCommand(ctx, exec.c_str(), exec.length()) != REDIS_OK)
+    {
+        SWSS_LOG_THROW("failed to append EXEC to pipeline: %s", ctx->errstr);
+    }
+
+    // replies are MULTI status, QUEUED status per command and EXEC array
+
+    size_t count = commands.size() + 2;
+
+    bool failed = false;
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        redisReply* reply = NULL;
+
+        if (redisGetReply(ctx, (void**)&reply) != REDIS_OK)
+        {
+            SWSS_LOG_THROW("failed to get transaction reply: %s", ctx->errstr);
+        }
+
+        swss::RedisReply r(reply);
+
+        if (reply->type == REDIS_REPLY_ERROR)
+        {
+            SWSS_LOG_ERROR("transaction reply %zu is error: %s", idx, std::string(reply->str, reply->len).c_str());
+
+            failed = true;
+        }
+        else if (idx == count - 1)
+        {
+            // EXEC returns nil when transaction was aborted
+
+            if (reply->type != REDIS_REPLY_ARRAY)
+            {
+                failed = true;
+                continue;
+            }
+
+            for (size_t i = 0; i < reply->elements; i++)
+            {
+                if (reply->element[i]->type == REDIS_REPLY_ERROR)
+                {
+                    SWSS_LOG_ERROR("transaction command %zu failed: %s",
+                            i,
+                            std::string(reply->element[i]->str, reply->element[i]->len).c_str());
+
+                    failed = true;
+                }
+            }
+        }
+    }
+
+    if (failed)
+    {
+        SWSS_LOG_THROW("transaction with %zu commands failed", commands.size());
+    }
+}
+
+void RedisClient::pipelineCommands(
+        _In_ swss::DBConnector& db,
+        _In_ const std::vector<std::string>& commands)
+{
+    SWSS_LOG_ENTER();
+
+    redisContext* ctx = db.getContext();
+
+    for (auto& cmd: commands)
+    {
+        if (redisAppendFormattedCommand(ctx, cmd.data(), cmd.size()) != REDIS_OK)
+        {
+            SWSS_LOG_THROW("failed to append command to pipeline: %s", ctx->errstr);
+        }
+    }
+
+    // all replies must be consumed, connection is shared
+
+    bool failed = false;
+
+    for (size_t idx = 0; idx < commands.size(); idx++)
+    {
+        redisReply* reply = NULL;
+
+        if (redisGetReply(ctx, (void**)&reply) != REDIS_OK)
+        {
+            SWSS_LOG_THROW("failed to get pipelined reply: %s", ctx->errstr);
+        }
+
+        swss::RedisReply r(reply);
+
+        if (reply->type == REDIS_REPLY_ERROR)
+        {
+            SWSS_LOG_ERROR("pipelined command %zu failed: %s", idx, std::string(reply->str, reply->len).c_str());
+
+            failed = true;
+        }
+    }
+
+    if (failed)
+    {
+        SWSS_LOG_THROW("pipeline with %zu commands failed", commands.size());
+    }
+}
+
+static void enqueueHmset(
+        _Inout_ std::vector<std::string>& commands,
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t idx = 0; idx < values.size(); idx += REDIS_CLIENT_MAX_FIELDS_PER_COMMAND)
+    {
+        size_t end = std::min(values.size(), idx + REDIS_CLIENT_MAX_FIELDS_PER_COMMAND);
+
+        swss::RedisCommand cmd;
+
+        cmd.formatHMSET(key, values.begin() + idx, values.begin() + end);
+
+        commands.emplace_back(cmd.c_str(), cmd.length());
+    }
+}
+
+static void enqueueHdel(
+        _Inout_ std::vector<std::string>& commands,
+        _In_ const std::string& key,
+        _In_ const std::vector<std::string>& fields)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t idx = 0; idx < fields.size(); idx += REDIS_CLIENT_MAX_FIELDS_PER_COMMAND)
+    {
+        size_t end = std::min(fields.size(), idx + REDIS_CLIENT_MAX_FIELDS_PER_COMMAND);
+
+        std::vector<const char*> argv;
+        std::vector<size_t> argvlen;
+
+        argv.push_back("HDEL");
+        argvlen.push_back(4);
+
+        argv.push_back(key.c_str());
+        argvlen.push_back(key.size());
+
+        for (size_t i = idx; i < end; i++)
+        {
+            argv.push_back(fields[i].c_str());
+            argvlen.push_back(fields[i].size());
+        }
+
+        swss::RedisCommand cmd;
+
+        cmd.formatArgv((int)argv.size(), argv.data(), argvlen.data());
+
+        commands.emplace_back(cmd.c_str(), cmd.length());
+    }
+}
+
+static void enqueueDel(
+        _Inout_ std::vector<std::string>& commands,
+        _In_ const std::vector<std::string>& keys)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t idx = 0; idx < keys.size(); idx += REDIS_CLIENT_MAX_FIELDS_PER_COMMAND)
+    {
+        size_t end = std::min(keys.size(), idx + REDIS_CLIENT_MAX_FIELDS_PER_COMMAND);
+
+        std::vector<const char*> argv;
+        std::vector<size_t> argvlen;
+
+        argv.push_back("DEL");
+        argvlen.push_back(3);
+
+        for (size_t i = idx; i < end; i++)
+        {
+            argv.push_back(keys[i].c_str());
+            argvlen.push_back(keys[i].size());
+        }
+
+        swss::RedisCommand cmd;
+
+        cmd.formatArgv((int)argv.size(), argv.data(), argvlen.data());
+
+        commands.emplace_back(cmd.c_str(), cmd.length());
+    }
+}
+
 RedisClient::RedisClient(
         _In_ std::shared_ptr<swss::DBConnector> dbAsic,
         _In_ std::shared_ptr<swss::DBConnector> dbFlexCounter):
@@ -23,6 +354,13 @@ RedisClient::RedisClient(
     m_dbFlexcounter(dbFlexCounter)
 {
     SWSS_LOG_ENTER();
+
+    // ASIC state keys are indexed per object type and flex counter keys per
+    // group, groups are kept in single bucket
+
+    m_asicStateIndex = std::make_shared<RedisKeyIndex>(m_dbAsic, ASIC_STATE_INDEX, ASIC_STATE_TABLE ":*", &getTableKeyBucket);
+    m_flexCounterIndex = std::make_shared<RedisKeyIndex>(m_dbFlexcounter, FLEX_COUNTER_INDEX, FLEX_COUNTER_TABLE ":*", &getTableKeyBucket);
+    m_flexCounterGroupIndex = std::make_shared<RedisKeyIndex>(m_dbFlexcounter, FLEX_COUNTER_GROUP_INDEX, FLEX_COUNTER_GROUP_TABLE ":*", &getSingleBucket);
 }
 
 RedisClient::~RedisClient()
@@ -130,7 +468,15 @@ void RedisClient::removeAsicObject(
 
     SWSS_LOG_INFO("removing ASIC DB key: %s", key.c_str());
 
-    m_dbAsic->del(key);
+    // key and its index entry are removed in single transaction
+
+    std::vector<std::string> commands;
+
+    enqueueDel(commands, { key });
+
+    m_asicStateIndex->addRemoveCommands(commands, { key });
+
+    pipelineTransaction(*m_dbAsic, commands);
 }
 
 void RedisClient::removeAsicObject(
@@ -140,7 +486,13 @@ void RedisClient::removeAsicObject(
 
     std::string key = (ASIC_STATE_TABLE ":") + otai_serialize_object_meta_key(metaKey);
 
-    m_dbAsic->del(key);
+    std::vector<std::string> commands;
+
+    enqueueDel(commands, { key });
+
+    m_asicStateIndex->addRemoveCommands(commands, { key });
+
+    pipelineTransaction(*m_dbAsic, commands);
 }
 
 void RedisClient::removeAsicObjects(
@@ -156,7 +508,13 @@ void RedisClient::removeAsicObjects(
          prefixKeys.push_back((ASIC_STATE_TABLE ":") + key);
     }
 
-    m_dbAsic->del(prefixKeys);
+    std::vector<std::string> commands;
+
+    enqueueDel(commands, prefixKeys);
+
+    m_asicStateIndex->addRemoveCommands(commands, prefixKeys);
+
+    pipelineTransaction(*m_dbAsic, commands);
 }
 
 void RedisClient::setAsicObject(
@@ -179,16 +537,22 @@ void RedisClient::createAsicObject(
 
     std::string key = (ASIC_STATE_TABLE ":") + otai_serialize_object_meta_key(metaKey);
 
+    // data and index entry are written in single transaction
+
+    std::vector<std::string> commands;
+
     if (attrs.size() == 0)
     {
-        m_dbAsic->hset(key, "NULL", "NULL");
-        return;
+        enqueueHmset(commands, key, { { "NULL", "NULL" } });
     }
-
-    for (const auto& e: attrs)
+    else
     {
-        m_dbAsic->hset(key, fvField(e), fvValue(e));
+        enqueueHmset(commands, key, attrs);
     }
+
+    m_asicStateIndex->addInsertCommands(commands, { key });
+
+    pipelineTransaction(*m_dbAsic, commands);
 }
 
 void RedisClient::createAsicObjects(
@@ -196,20 +560,31 @@ void RedisClient::createAsicObjects(
 {
     SWSS_LOG_ENTER();
 
-    std::unordered_map<std::string, std::vector<std::pair<std::string, std::string>>> hash;
+    std::vector<std::string> commands;
+    std::vector<std::string> keys;
 
     // we need to rewrite hash to add table prefix
     for (const auto& kvp: multiHash)
     {
-        hash[(ASIC_STATE_TABLE ":") + kvp.first] = kvp.second;
+        std::string key = (ASIC_STATE_TABLE ":") + kvp.first;
 
         if (kvp.second.size() == 0)
         {
-            hash[(ASIC_STATE_TABLE ":") + kvp.first].emplace_back(std::make_pair<std::string, std::string>("NULL", "NULL"));
+            enqueueHmset(commands, key, { { "NULL", "NULL" } });
         }
+        else
+        {
+            enqueueHmset(commands, key, kvp.second);
+        }
+
+        keys.push_back(key);
     }
 
-    m_dbAsic->hmset(hash);
+    // data and index entries are written in single transaction
+
+    m_asicStateIndex->addInsertCommands(commands, keys);
+
+    pipelineTransaction(*m_dbAsic, commands);
 }
 
 void RedisClient::setVidAndRidMap(
@@ -217,38 +592,86 @@ void RedisClient::setVidAndRidMap(
 {
     SWSS_LOG_ENTER();
 
-    m_dbAsic->del(VIDTORID);
-    m_dbAsic->del(RIDTOVID);
+    std::vector<swss::FieldValueTuple> vid2rid;
+    std::vector<swss::FieldValueTuple> rid2vid;
+
+    vid2rid.reserve(map.size());
+    rid2vid.reserve(map.size());
 
     for (auto &kv: map)
     {
         std::string strVid = otai_serialize_object_id(kv.first);
         std::string strRid = otai_serialize_object_id(kv.second);
 
-        m_dbAsic->hset(VIDTORID, strVid, strRid);
-        m_dbAsic->hset(RIDTOVID, strRid, strVid);
+        vid2rid.emplace_back(strVid, strRid);
+        rid2vid.emplace_back(strRid, strVid);
     }
+
+    std::vector<std::string> commands;
+
+    swss::RedisCommand del;
+
+    del.format("DEL %s %s", VIDTORID, RIDTOVID);
+
+    commands.emplace_back(del.c_str(), del.length());
+
+    enqueueHmset(commands, VIDTORID, vid2rid);
+    enqueueHmset(commands, RIDTOVID, rid2vid);
+
+    pipelineTransaction(*m_dbAsic, commands);
 }
 
 std::vector<std::string> RedisClient::getAsicStateKeys() const
 {
     SWSS_LOG_ENTER();
 
-    return m_dbAsic->keys(ASIC_STATE_TABLE ":*");
+    return m_asicStateIndex->getKeys();
 }
 
 std::vector<std::string> RedisClient::getFlexCounterKeys() const
 {
     SWSS_LOG_ENTER();
 
-    return m_dbFlexcounter->keys(FLEX_COUNTER_TABLE ":*");
+    return m_flexCounterIndex->getKeys();
 }
 
 std::vector<std::string> RedisClient::getFlexCounterGroupKeys() const
 {
     SWSS_LOG_ENTER();
 
-    return m_dbFlexcounter->keys(FLEX_COUNTER_GROUP_TABLE ":*");
+    return m_flexCounterGroupIndex->getKeys();
+}
+
+void RedisClient::insertFlexCounterKey(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    m_flexCounterIndex->insert((FLEX_COUNTER_TABLE ":") + key);
+}
+
+void RedisClient::removeFlexCounterKey(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    m_flexCounterIndex->remove((FLEX_COUNTER_TABLE ":") + key);
+}
+
+void RedisClient::insertFlexCounterGroupKey(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    m_flexCounterGroupIndex->insert((FLEX_COUNTER_GROUP_TABLE ":") + key);
+}
+
+void RedisClient::removeFlexCounterGroupKey(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    m_flexCounterGroupIndex->remove((FLEX_COUNTER_GROUP_TABLE ":") + key);
 }
 
 std::unordered_map<std::string, std::string> RedisClient::getAttributesFromAsicKey(
@@ -261,6 +684,22 @@ std::unordered_map<std::string, std::string> RedisClient::getAttributesFromAsicK
     return map;
 }
 
+std::vector<std::vector<swss::FieldValueTuple>> RedisClient::getAttributesFromAsicKeys(
+        _In_ const std::vector<std::string>& keys) const
+{
+    SWSS_LOG_ENTER();
+
+    return pipelineHgetall(*m_dbAsic, keys);
+}
+
+std::vector<std::vector<swss::FieldValueTuple>> RedisClient::getAttributesFromFlexCounterKeys(
+        _In_ const std::vector<std::string>& keys) const
+{
+    SWSS_LOG_ENTER();
+
+    return pipelineHgetall(*m_dbFlexcounter, keys);
+}
+
 std::unordered_map<std::string, std::string> RedisClient::getAttributesFromFlexCounterGroupKey(
         _In_ const std::string& key) const
 {
@@ -287,11 +726,34 @@ void RedisClient::removeVidAndRid(
 {
     SWSS_LOG_ENTER();
 
-    auto strVid = otai_serialize_object_id(vid);
-    auto strRid = otai_serialize_object_id(rid);
+    removeVidsAndRids({std::make_pair(vid, rid)});
+}
+
+void RedisClient::removeVidsAndRids(
+        _In_ const std::vector<std::pair<otai_object_id_t, otai_object_id_t>>& vidRidPairs)
+{
+    SWSS_LOG_ENTER();
+
+    if (vidRidPairs.empty())
+    {
+        return;
+    }
+
+    std::vector<std::string> vids;
+    std::vector<std::string> rids;
+
+    for (auto& p: vidRidPairs)
+    {
+        vids.push_back(otai_serialize_object_id(p.first));
+        rids.push_back(otai_serialize_object_id(p.second));
+    }
 
-    m_dbAsic->hdel(VIDTORID, strVid);
-    m_dbAsic->hdel(RIDTOVID, strRid);
+    std::vector<std::string> commands;
+
+    enqueueHdel(commands, VIDTORID, vids);
+    enqueueHdel(commands, RIDTOVID, rids);
+
+    pipelineTransaction(*m_dbAsic, commands);
 }
 
 void RedisClient::insertVidAndRid(
@@ -300,11 +762,37 @@ void RedisClient::insertVidAndRid(
 {
     SWSS_LOG_ENTER();
 
-    auto strVid = otai_serialize_object_id(vid);
-    auto strRid = otai_serialize_object_id(rid);
+    insertVidsAndRids({std::make_pair(vid, rid)});
+}
+
+void RedisClient::insertVidsAndRids(
+        _In_ const std::vector<std::pair<otai_object_id_t, otai_object_id_t>>& vidRidPairs)
+{
+    SWSS_LOG_ENTER();
+
+    if (vidRidPairs.empty())
+    {
+        return;
+    }
 
-    m_dbAsic->hset(VIDTORID, strVid, strRid);
-    m_dbAsic->hset(RIDTOVID, strRid, strVid);
+    std::vector<swss::FieldValueTuple> vid2rid;
+    std::vector<swss::FieldValueTuple> rid2vid;
+
+    for (auto& p: vidRidPairs)
+    {
+        std::string strVid = otai_serialize_object_id(p.first);
+        std::string strRid = otai_serialize_object_id(p.second);
+
+        vid2rid.emplace_back(strVid, strRid);
+        rid2vid.emplace_back(strRid, strVid);
+    }
+
+    std::vector<std::string> commands;
+
+    enqueueHmset(commands, VIDTORID, vid2rid);
+    enqueueHmset(commands, RIDTOVID, rid2vid);
+
+    pipelineTransaction(*m_dbAsic, commands);
 }
 
 otai_object_id_t RedisClient::getVidForRid(
@@ -331,6 +819,53 @@ otai_object_id_t RedisClient::getVidForRid(
     return vid;
 }
 
+std::vector<otai_object_id_t> RedisClient::getVidsForRids(
+        _In_ const std::vector<otai_object_id_t>& rids)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<otai_object_id_t> vids(rids.size(), OTAI_NULL_OBJECT_ID);
+
+    if (rids.empty())
+    {
+        return vids;
+    }
+
+    std::vector<std::string> fields;
+
+    for (auto rid: rids)
+    {
+        fields.push_back(otai_serialize_object_id(rid));
+    }
+
+    std::vector<const char*> argv = { "HMGET", RIDTOVID };
+    std::vector<size_t> argvlen = { 5, strlen(RIDTOVID) };
+
+    for (auto& field: fields)
+    {
+        argv.push_back(field.c_str());
+        argvlen.push_back(field.size());
+    }
+
+    swss::RedisCommand cmd;
+
+    cmd.formatArgv((int)argv.size(), argv.data(), argvlen.data());
+
+    swss::RedisReply r(m_dbAsic.get(), cmd, REDIS_REPLY_ARRAY);
+
+    auto reply = r.getContext();
+
+    for (size_t idx = 0; idx < reply->elements && idx < vids.size(); idx++)
+    {
+        if (reply->element[idx]->type == REDIS_REPLY_STRING)
+        {
+            otai_deserialize_object_id(std::string(reply->element[idx]->str, reply->element[idx]->len), vids[idx]);
+        }
+    }
+
+    return vids;
+}
+
 otai_object_id_t RedisClient::getRidForVid(
         _In_ otai_object_id_t vid)
 {
@@ -4,6 +4,8 @@ extern "C" {
 #include "otaimetadata.h"
 }
 
+#include "RedisKeyIndex.h"
+
 #include "swss/table.h"
 
 #include <string>
@@ -51,6 +53,11 @@ namespace syncd
             void createAsicObjects(
                     _In_ const std::unordered_map<std::string, std::vector<swss::FieldValueTuple>>& multiHash);
 
+            /**
+             * @brief Replace VIDTORID and RIDTOVID maps.
+             *
+             * Both maps are replaced in single transaction.
+             */
             void setVidAndRidMap(
                     _In_ const std::unordered_map<otai_object_id_t, otai_object_id_t>& map);
 
@@ -60,6 +67,25 @@ namespace syncd
 
             std::vector<std::string> getFlexCounterGroupKeys() const;
 
+            /**
+             * @brief Update flex counter key indexes.
+             *
+             * Flex counter tables are written by consumer table, so syncd
+             * must update indexes when processing events. Key is table key
+             * without table name.
+             */
+            void insertFlexCounterKey(
+                    _In_ const std::string& key);
+
+            void removeFlexCounterKey(
+                    _In_ const std::string& key);
+
+            void insertFlexCounterGroupKey(
+                    _In_ const std::string& key);
+
+            void removeFlexCounterGroupKey(
+                    _In_ const std::string& key);
+
             std::unordered_map<std::string, std::string> getAttributesFromFlexCounterKey(_In_ const std::string& key) const;
 
             std::unordered_map<std::string, std::string> getAttributesFromFlexCounterGroupKey(_In_ const std::string& key) const;
@@ -67,6 +93,24 @@ namespace syncd
             std::unordered_map<std::string, std::string> getAttributesFromAsicKey(
                     _In_ const std::string& key) const;
 
+            /**
+             * @brief Get attributes of multiple ASIC keys.
+             *
+             * HGETALL commands are pipelined in batches, so whole ASIC state
+             * is loaded with few round trips instead of one per object.
+             * Returned vector has the same order as given keys.
+             */
+            std::vector<std::vector<swss::FieldValueTuple>> getAttributesFromAsicKeys(
+                    _In_ const std::vector<std::string>& keys) const;
+
+            /**
+             * @brief Get attributes of multiple flex counter keys.
+             *
+             * Same as getAttributesFromAsicKeys but for FLEX_COUNTER_DB.
+             */
+            std::vector<std::vector<swss::FieldValueTuple>> getAttributesFromFlexCounterKeys(
+                    _In_ const std::vector<std::string>& keys) const;
+
             void removeVidAndRid(
                     _In_ otai_object_id_t vid,
                     _In_ otai_object_id_t rid);
@@ -75,9 +119,34 @@ namespace syncd
                     _In_ otai_object_id_t vid,
                     _In_ otai_object_id_t rid);
 
+            /**
+             * @brief Remove VID/RID pairs from both maps in single transaction.
+             *
+             * Each pair is (VID, RID).
+             */
+            void removeVidsAndRids(
+                    _In_ const std::vector<std::pair<otai_object_id_t, otai_object_id_t>>& vidRidPairs);
+
+            /**
+             * @brief Insert VID/RID pairs to both maps in single transaction.
+             *
+             * Each pair is (VID, RID).
+             */
+            void insertVidsAndRids(
+                    _In_ const std::vector<std::pair<otai_object_id_t, otai_object_id_t>>& vidRidPairs);
+
             otai_object_id_t getVidForRid(
                     _In_ otai_object_id_t rid);
 
+            /**
+             * @brief Get VIDs of multiple RIDs using single HMGET.
+             *
+             * Returned vector has the same order as given RIDs, missing
+             * mapping is OTAI_NULL_OBJECT_ID.
+             */
+            std::vector<otai_object_id_t> getVidsForRids(
+                    _In_ const std::vector<otai_object_id_t>& rids);
+
             otai_object_id_t getRidForVid(
                     _In_ otai_object_id_t vid);
 
@@ -86,6 +155,38 @@ namespace syncd
                     _In_ const std::string& attr,
                     _In_ const std::string& value);
 
+        public:
+
+            /**
+             * @brief Get hashes of given keys using pipelined HGETALL.
+             *
+             * Returned vector has the same order as given keys.
+             */
+            static std::vector<std::vector<swss::FieldValueTuple>> pipelineHgetall(
+                    _In_ swss::DBConnector& db,
+                    _In_ const std::vector<std::string>& keys);
+
+            /**
+             * @brief Execute formatted commands in MULTI/EXEC transaction
+             * sent as single pipelined write.
+             *
+             * Throws when any command fails.
+             */
+            static void pipelineTransaction(
+                    _In_ swss::DBConnector& db,
+                    _In_ const std::vector<std::string>& commands);
+
+            /**
+             * @brief Execute formatted commands sent as single pipelined
+             * write, without transaction.
+             *
+             * Redis can serve other clients between commands. Throws when
+             * any command fails.
+             */
+            static void pipelineCommands(
+                    _In_ swss::DBConnector& db,
+                    _In_ const std::vector<std::string>& commands);
+
         private:
             std::unordered_map<otai_object_id_t, otai_object_id_t> getObjectMap(
                     _In_ const std::string& key) const;
@@ -95,5 +196,9 @@ namespace syncd
             std::shared_ptr<swss::DBConnector> m_dbAsic;
             std::shared_ptr<swss::DBConnector> m_dbFlexcounter;
 
+            std::shared_ptr<RedisKeyIndex> m_asicStateIndex;
+            std::shared_ptr<RedisKeyIndex> m_flexCounterIndex;
+            std::shared_ptr<RedisKeyIndex> m_flexCounterGroupIndex;
+
     };
 }
@@ -0,0 +1,377 @@
+#include "RedisKeyIndex.h"
+#include "RedisClient.h"
+
+#include "swss/logger.h"
+#include "swss/rediscommand.h"
+#include "swss/redisreply.h"
+
+#include <map>
+#include <algorithm>
+
+using namespace syncd;
+
+#define REDIS_KEY_INDEX_VALID_SUFFIX "_VALID"
+
+/*
+ * Number of keys examined by single SCAN/SSCAN call, and maximum number of
+ * members passed in single SADD/SREM command.
+ */
+#define REDIS_KEY_INDEX_BATCH_SIZE 1000
+
+/*
+ * Maximum number of SADD commands sent in single pipeline on rebuild.
+ */
+#define REDIS_KEY_INDEX_PIPELINE_SIZE 64
+
+RedisKeyIndex::RedisKeyIndex(
+        _In_ std::shared_ptr<swss::DBConnector> db,
+        _In_ const std::string& indexName,
+        _In_ const std::string& pattern,
+        _In_ BucketFunction getBucket):
+    m_db(db),
+    m_indexName(indexName),
+    m_pattern(pattern),
+    m_getBucket(getBucket),
+    m_valid(false)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+std::vector<std::string> RedisKeyIndex::scanKeys(
+        _In_ swss::DBConnector& db,
+        _In_ const std::string& pattern)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> keys;
+
+    std::string cursor = "0";
+
+    do
+    {
+        swss::RedisCommand cmd;
+
+        cmd.format("SCAN %s MATCH %s COUNT %d", cursor.c_str(), pattern.c_str(), REDIS_KEY_INDEX_BATCH_SIZE);
+
+        swss::RedisReply r(&db, cmd, REDIS_REPLY_ARRAY);
+
+        auto reply = r.getContext();
+
+        if (reply->elements != 2)
+        {
+            SWSS_LOG_THROW("unexpected SCAN reply with %zu elements", reply->elements);
+        }
+
+        cursor = reply->element[0]->str;
+
+        auto list = reply->element[1];
+
+        for (size_t idx = 0; idx < list->elements; idx++)
+        {
+            keys.emplace_back(list->element[idx]->str, list->element[idx]->len);
+        }
+    }
+    while (cursor != "0");
+
+    // SCAN can return same key more than once
+
+    std::sort(keys.begin(), keys.end());
+
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    return keys;
+}
+
+std::string RedisKeyIndex::getBucketSetName(
+        _In_ const std::string& bucket) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_indexName + ":" + bucket;
+}
+
+std::vector<std::string> RedisKeyIndex::smembers(
+        _In_ const std::string& set)
+{
+    SWSS_LOG_ENTER();
+
+    // bucket can hold most of keyspace, SSCAN doesn't block redis for whole
+    // set as SMEMBERS does
+
+    std::vector<std::string> members;
+
+    std::string cursor = "0";
+
+    do
+    {
+        swss::RedisCommand cmd;
+
+        cmd.format("SSCAN %s %s COUNT %d", set.c_str(), cursor.c_str(), REDIS_KEY_INDEX_BATCH_SIZE);
+
+        swss::RedisReply r(m_db.get(), cmd, REDIS_REPLY_ARRAY);
+
+        auto reply = r.getContext();
+
+        if (reply->elements != 2)
+        {
+            SWSS_LOG_THROW("unexpected SSCAN reply with %zu elements", reply->elements);
+        }
+
+        cursor = reply->element[0]->str;
+
+        auto list = reply->element[1];
+
+        for (size_t idx = 0; idx < list->elements; idx++)
+        {
+            members.emplace_back(list->element[idx]->str, list->element[idx]->len);
+        }
+    }
+    while (cursor != "0");
+
+    // SSCAN can return same member more than once
+
+    std::sort(members.begin(), members.end());
+
+    members.erase(std::unique(members.begin(), members.end()), members.end());
+
+    return members;
+}
+
+void RedisKeyIndex::addSetCommands(
+        _Inout_ std::vector<std::string>& commands,
+        _In_ const std::string& command,
+        _In_ const std::string& set,
+        _In_ const std::vector<std::string>& members)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t idx = 0; idx < members.size(); idx += REDIS_KEY_INDEX_BATCH_SIZE)
+    {
+        size_t end = std::min(members.size(), idx + REDIS_KEY_INDEX_BATCH_SIZE);
+
+        std::vector<const char*> argv;
+        std::vector<size_t> argvlen;
+
+        argv.push_back(command.c_str());
+        argvlen.push_back(command.size());
+
+        argv.push_back(set.c_str());
+        argvlen.push_back(set.size());
+
+        for (size_t i = idx; i < end; i++)
+        {
+            argv.push_back(members[i].c_str());
+            argvlen.push_back(members[i].size());
+        }
+
+        swss::RedisCommand cmd;
+
+        cmd.formatArgv((int)argv.size(), argv.data(), argvlen.data());
+
+        commands.emplace_back(cmd.c_str(), cmd.length());
+    }
+}
+
+void RedisKeyIndex::setCommand(
+        _In_ const std::string& command,
+        _In_ const std::string& set,
+        _In_ const std::vector<std::string>& members)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> commands;
+
+    addSetCommands(commands, command, set, members);
+
+    RedisClient::pipelineTransaction(*m_db, commands);
+}
+
+void RedisKeyIndex::rebuildIfNeeded()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_valid)
+    {
+        return;
+    }
+
+    std::string marker = m_indexName + REDIS_KEY_INDEX_VALID_SUFFIX;
+
+    if (m_db->exists(marker))
+    {
+        m_valid = true;
+        return;
+    }
+
+    SWSS_LOG_NOTICE("index %s not present, building it using SCAN %s",
+            m_indexName.c_str(),
+            m_pattern.c_str());
+
+    auto keys = scanKeys(*m_db, m_pattern);
+
+    std::map<std::string, std::vector<std::string>> buckets;
+
+    for (auto& key: keys)
+    {
+        buckets[getBucketSetName(m_getBucket(key))].push_back(key);
+    }
+
+    // rebuild only adds members and marker is set last, so SADDs are sent
+    // in plain pipelines, single transaction would block redis for whole
+    // keyspace
+
+    std::vector<std::string> commands;
+    std::vector<std::string> bucketSets;
+
+    for (auto& kvp: buckets)
+    {
+        auto& members = kvp.second;
+
+        for (size_t idx = 0; idx < members.size(); idx += REDIS_KEY_INDEX_BATCH_SIZE * REDIS_KEY_INDEX_PIPELINE_SIZE)
+        {
+            size_t end = std::min(members.size(), idx + REDIS_KEY_INDEX_BATCH_SIZE * REDIS_KEY_INDEX_PIPELINE_SIZE);
+
+            addSetCommands(commands, "SADD", kvp.first, std::vector<std::string>(members.begin() + idx, members.begin() + end));
+
+            RedisClient::pipelineCommands(*m_db, commands);
+
+            commands.clear();
+        }
+
+        bucketSets.push_back(kvp.first);
+    }
+
+    addSetCommands(commands, "SADD", m_indexName, bucketSets);
+
+    RedisClient::pipelineCommands(*m_db, commands);
+
+    m_db->set(marker, "1");
+
+    m_valid = true;
+
+    SWSS_LOG_NOTICE("index %s built with %zu keys in %zu buckets",
+            m_indexName.c_str(),
+            keys.size(),
+            buckets.size());
+}
+
+std::vector<std::string> RedisKeyIndex::getKeys()
+{
+    SWSS_LOG_ENTER();
+
+    rebuildIfNeeded();
+
+    std::vector<std::string> keys;
+
+    for (auto& set: smembers(m_indexName))
+    {
+        auto members = smembers(set);
+
+        keys.insert(keys.end(), members.begin(), members.end());
+    }
+
+    return keys;
+}
+
+std::vector<std::string> RedisKeyIndex::getKeys(
+        _In_ const std::string& bucket)
+{
+    SWSS_LOG_ENTER();
+
+    rebuildIfNeeded();
+
+    return smembers(getBucketSetName(bucket));
+}
+
+void RedisKeyIndex::insert(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> commands;
+
+    addInsertCommands(commands, { key });
+
+    RedisClient::pipelineTransaction(*m_db, commands);
+}
+
+void RedisKeyIndex::remove(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    remove(std::vector<std::string>{ key });
+}
+
+void RedisKeyIndex::remove(
+        _In_ const std::vector<std::string>& keys)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> commands;
+
+    addRemoveCommands(commands, keys);
+
+    RedisClient::pipelineTransaction(*m_db, commands);
+}
+
+void RedisKeyIndex::addInsertCommands(
+        _Inout_ std::vector<std::string>& commands,
+        _In_ const std::vector<std::string>& keys) const
+{
+    SWSS_LOG_ENTER();
+
+    // if index is not yet valid, it will be rebuilt on first read and these
+    // keys will be picked up by SCAN, so insert is always safe
+
+    std::map<std::string, std::vector<std::string>> buckets;
+
+    for (auto& key: keys)
+    {
+        buckets[getBucketSetName(m_getBucket(key))].push_back(key);
+    }
+
+    std::vector<std::string> bucketSets;
+
+    for (auto& kvp: buckets)
+    {
+        addSetCommands(commands, "SADD", kvp.first, kvp.second);
+
+        bucketSets.push_back(kvp.first);
+    }
+
+    addSetCommands(commands, "SADD", m_indexName, bucketSets);
+}
+
+void RedisKeyIndex::addRemoveCommands(
+        _Inout_ std::vector<std::string>& commands,
+        _In_ const std::vector<std::string>& keys) const
+{
+    SWSS_LOG_ENTER();
+
+    std::map<std::string, std::vector<std::string>> buckets;
+
+    for (auto& key: keys)
+    {
+        buckets[getBucketSetName(m_getBucket(key))].push_back(key);
+    }
+
+    for (auto& kvp: buckets)
+    {
+        addSetCommands(commands, "SREM", kvp.first, kvp.second);
+    }
+}
+
+void RedisKeyIndex::removeBucket(
+        _In_ const std::string& bucket)
+{
+    SWSS_LOG_ENTER();
+
+    auto set = getBucketSetName(bucket);
+
+    m_db->del(set);
+
+    setCommand("SREM", m_indexName, { set });
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "swss/dbconnector.h"
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+
+namespace syncd
+{
+    /**
+     * @brief Redis key index.
+     *
+     * Keeps explicit index of keys matching given pattern, so keys can be
+     * listed without KEYS command which blocks redis server for whole
+     * keyspace walk. Keys are grouped into buckets (for example per object
+     * type), each bucket is redis set "<indexName>:<bucket>" and set
+     * "<indexName>" holds names of all bucket sets.
+     *
+     * Index is marked valid by "<indexName>_VALID" key. When marker is
+     * missing (database created before index was introduced), keys are
+     * collected by incremental SCAN and index is rebuilt.
+     *
+     * All writers of indexed keys must update the index.
+     */
+    class RedisKeyIndex
+    {
+        public:
+
+            typedef std::function<std::string(const std::string&)> BucketFunction;
+
+            RedisKeyIndex(
+                    _In_ std::shared_ptr<swss::DBConnector> db,
+                    _In_ const std::string& indexName,
+                    _In_ const std::string& pattern,
+                    _In_ BucketFunction getBucket);
+
+            virtual ~RedisKeyIndex() = default;
+
+        public:
+
+            /**
+             * @brief Get all indexed keys.
+             */
+            std::vector<std::string> getKeys();
+
+            /**
+             * @brief Get keys from single bucket.
+             */
+            std::vector<std::string> getKeys(
+                    _In_ const std::string& bucket);
+
+            void insert(
+                    _In_ const std::string& key);
+
+            void remove(
+                    _In_ const std::string& key);
+
+            void remove(
+                    _In_ const std::vector<std::string>& keys);
+
+            /**
+             * @brief Append formatted commands which add keys to index.
+             *
+             * Used by writers to send index update in the same pipeline or
+             * transaction as key data.
+             */
+            void addInsertCommands(
+                    _Inout_ std::vector<std::string>& commands,
+                    _In_ const std::vector<std::string>& keys) const;
+
+            /**
+             * @brief Append formatted commands which remove keys from index.
+             */
+            void addRemoveCommands(
+                    _Inout_ std::vector<std::string>& commands,
+                    _In_ const std::vector<std::string>& keys) const;
+
+            /**
+             * @brief Remove bucket set from index.
+             *
+             * Keys itself are not removed.
+             */
+            void removeBucket(
+                    _In_ const std::string& bucket);
+
+        public:
+
+            /**
+             * @brief Get keys matching pattern using incremental SCAN.
+             */
+            static std::vector<std::string> scanKeys(
+                    _In_ swss::DBConnector& db,
+                    _In_ const std::string& pattern);
+
+        private:
+
+            std::string getBucketSetName(
+                    _In_ const std::string& bucket) const;
+
+            void rebuildIfNeeded();
+
+            std::vector<std::string> smembers(
+                    _In_ const std::string& set);
+
+            /**
+             * @brief Append set command split into batches of members.
+             */
+            static void addSetCommands(
+                    _Inout_ std::vector<std::string>& commands,
+                    _In_ const std::string& command,
+                    _In_ const std::string& set,
+                    _In_ const std::vector<std::string>& members);
+
+            void setCommand(
+                    _In_ const std::string& command,
+                    _In_ const std::string& set,
+                    _In_ const std::vector<std::string>& members);
+
+        private:
+
+            std::shared_ptr<swss::DBConnector> m_db;
+
+            std::string m_indexName;
+
+            std::string m_pattern;
+
+            BucketFunction m_getBucket;
+
+            bool m_valid;
+    };
+}
@@ -0,0 +1,259 @@
+#include "RedisTimeIndex.h"
+#include "RedisKeyIndex.h"
+
+#include "swss/logger.h"
+#include "swss/rediscommand.h"
+#include "swss/redisreply.h"
+
+#include <algorithm>
+
+using namespace syncd;
+
+#define REDIS_TIME_INDEX_VALID_SUFFIX "_VALID"
+
+/*
+ * Maximum number of members passed in single ZADD command during rebuild.
+ */
+#define REDIS_TIME_INDEX_BATCH_SIZE 1000
+
+RedisTimeIndex::RedisTimeIndex(
+        _In_ std::shared_ptr<swss::DBConnector> db,
+        _In_ const std::string& indexName,
+        _In_ const std::string& pattern,
+        _In_ ParseFunction parse):
+    m_db(db),
+    m_indexName(indexName),
+    m_pattern(pattern),
+    m_parse(parse),
+    m_valid(false)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+std::string RedisTimeIndex::getBucketSetName(
+        _In_ const std::string& bucket) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_indexName + ":" + bucket;
+}
+
+size_t RedisTimeIndex::getSize(
+        _In_ const std::string& set)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_sizes.find(set);
+
+    if (it != m_sizes.end())
+    {
+        return it->second;
+    }
+
+    swss::RedisCommand cmd;
+
+    cmd.format("ZCARD %s", set.c_str());
+
+    swss::RedisReply r(m_db.get(), cmd, REDIS_REPLY_INTEGER);
+
+    size_t size = (size_t)r.getContext()->integer;
+
+    m_sizes[set] = size;
+
+    return size;
+}
+
+std::vector<std::string> RedisTimeIndex::rangeByScore(
+        _In_ const std::string& set,
+        _In_ const std::string& min,
+        _In_ const std::string& max)
+{
+    SWSS_LOG_ENTER();
+
+    swss::RedisCommand cmd;
+
+    cmd.format("ZRANGEBYSCORE %s %s %s", set.c_str(), min.c_str(), max.c_str());
+
+    swss::RedisReply r(m_db.get(), cmd, REDIS_REPLY_ARRAY);
+
+    auto reply = r.getContext();
+
+    std::vector<std::string> members;
+
+    for (size_t idx = 0; idx < reply->elements; idx++)
+    {
+        members.emplace_back(reply->element[idx]->str, reply->element[idx]->len);
+    }
+
+    return members;
+}
+
+void RedisTimeIndex::rebuildIfNeeded()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_valid)
+    {
+        return;
+    }
+
+    std::string marker = m_indexName + REDIS_TIME_INDEX_VALID_SUFFIX;
+
+    if (m_db->exists(marker))
+    {
+        m_valid = true;
+        return;
+    }
+
+    SWSS_LOG_NOTICE("index %s not present, building it using SCAN %s",
+            m_indexName.c_str(),
+            m_pattern.c_str());
+
+    auto keys = RedisKeyIndex::scanKeys(*m_db, m_pattern);
+
+    std::map<std::string, std::vector<std::pair<std::string, std::string>>> buckets;
+
+    for (auto& key: keys)
+    {
+        std::string bucket;
+        uint64_t time = 0;
+
+        if (m_parse(key, bucket, time))
+        {
+            buckets[getBucketSetName(bucket)].emplace_back(std::to_string(time), key);
+        }
+    }
+
+    for (auto& kvp: buckets)
+    {
+        auto& members = kvp.second;
+
+        for (size_t idx = 0; idx < members.size(); idx += REDIS_TIME_INDEX_BATCH_SIZE)
+        {
+            size_t end = std::min(members.size(), idx + REDIS_TIME_INDEX_BATCH_SIZE);
+
+            std::vector<const char*> argv = { "ZADD", kvp.first.c_str() };
+            std::vector<size_t> argvlen = { 4, kvp.first.size() };
+
+            for (size_t i = idx; i < end; i++)
+            {
+                argv.push_back(members[i].first.c_str());
+                argvlen.push_back(members[i].first.size());
+
+                argv.push_back(members[i].second.c_str());
+                argvlen.push_back(members[i].second.size());
+            }
+
+            swss::RedisCommand cmd;
+
+            cmd.formatArgv((int)argv.size(), argv.data(), argvlen.data());
+
+            swss::RedisReply r(m_db.get(), cmd, REDIS_REPLY_INTEGER);
+        }
+    }
+
+    m_db->set(marker, "1");
+
+    m_sizes.clear();
+
+    m_valid = true;
+
+    SWSS_LOG_NOTICE("index %s built with %zu keys in %zu buckets",
+            m_indexName.c_str(),
+            keys.size(),
+            buckets.size());
+}
+
+void RedisTimeIndex::insert(
+        _In_ const std::string& bucket,
+        _In_ const std::string& key,
+        _In_ uint64_t time)
+{
+    SWSS_LOG_ENTER();
+
+    // if index is not yet valid, it will be rebuilt on first read and this
+    // key will be picked up by SCAN, ZADD of same member only updates score
+
+    auto set = getBucketSetName(bucket);
+
+    std::string score = std::to_string(time);
+
+    swss::RedisCommand cmd;
+
+    cmd.format("ZADD %s %s %s", set.c_str(), score.c_str(), key.c_str());
+
+    swss::RedisReply r(m_db.get(), cmd, REDIS_REPLY_INTEGER);
+
+    auto it = m_sizes.find(set);
+
+    if (it != m_sizes.end())
+    {
+        it->second += (size_t)r.getContext()->integer;
+    }
+}
+
+std::vector<std::string> RedisTimeIndex::getRange(
+        _In_ const std::string& bucket,
+        _In_ uint64_t from,
+        _In_ uint64_t to)
+{
+    SWSS_LOG_ENTER();
+
+    rebuildIfNeeded();
+
+    return rangeByScore(getBucketSetName(bucket), std::to_string(from), std::to_string(to));
+}
+
+std::vector<std::string> RedisTimeIndex::trim(
+        _In_ const std::string& bucket,
+        _In_ size_t maxSize)
+{
+    SWSS_LOG_ENTER();
+
+    rebuildIfNeeded();
+
+    auto set = getBucketSetName(bucket);
+
+    size_t size = getSize(set);
+
+    if (size <= maxSize)
+    {
+        return {};
+    }
+
+    // score of newest key which must be removed, everything up to and
+    // including that score is removed
+
+    swss::RedisCommand cmd;
+
+    cmd.format("ZRANGEBYSCORE %s -inf +inf WITHSCORES LIMIT %zu 1", set.c_str(), size - maxSize - 1);
+
+    swss::RedisReply r(m_db.get(), cmd, REDIS_REPLY_ARRAY);
+
+    auto reply = r.getContext();
+
+    if (reply->elements != 2)
+    {
+        // cached size is out of date, reload it on next trim
+
+        m_sizes.erase(set);
+
+        return {};
+    }
+
+    std::string max(reply->element[1]->str, reply->element[1]->len);
+
+    auto keys = rangeByScore(set, "-inf", max);
+
+    cmd.format("ZREMRANGEBYSCORE %s -inf %s", set.c_str(), max.c_str());
+
+    swss::RedisReply rem(m_db.get(), cmd, REDIS_REPLY_INTEGER);
+
+    size_t removed = (size_t)rem.getContext()->integer;
+
+    m_sizes[set] = size > removed ? size - removed : 0;
+
+    return keys;
+}
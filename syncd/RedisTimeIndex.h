@@ -0,0 +1,106 @@
+#pragma once
+
+#include "swss/dbconnector.h"
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <map>
+
+namespace syncd
+{
+    /**
+     * @brief Redis time index.
+     *
+     * Keeps keys ordered by time in per bucket sorted sets
+     * "<indexName>:<bucket>", time is used as score. Range queries and
+     * retention are done by ZRANGEBYSCORE and ZREMRANGEBYSCORE, so their cost
+     * depends only on number of selected keys, not on number of stored keys.
+     *
+     * Score is double, so times with more than 53 significant bits (like
+     * nanoseconds since epoch) lose precision and close times may share
+     * score, ranges always include all keys with the boundary score.
+     *
+     * Index is marked valid by "<indexName>_VALID" key. When marker is
+     * missing, keys matching pattern are collected once by incremental SCAN
+     * and index is rebuilt.
+     */
+    class RedisTimeIndex
+    {
+        public:
+
+            /**
+             * @brief Extract bucket and time from indexed key.
+             *
+             * Returns false when key should not be indexed.
+             */
+            typedef std::function<bool(const std::string&, std::string&, uint64_t&)> ParseFunction;
+
+            RedisTimeIndex(
+                    _In_ std::shared_ptr<swss::DBConnector> db,
+                    _In_ const std::string& indexName,
+                    _In_ const std::string& pattern,
+                    _In_ ParseFunction parse);
+
+            virtual ~RedisTimeIndex() = default;
+
+        public:
+
+            void insert(
+                    _In_ const std::string& bucket,
+                    _In_ const std::string& key,
+                    _In_ uint64_t time);
+
+            /**
+             * @brief Get keys from bucket with time in [from, to], oldest
+             * first.
+             */
+            std::vector<std::string> getRange(
+                    _In_ const std::string& bucket,
+                    _In_ uint64_t from,
+                    _In_ uint64_t to);
+
+            /**
+             * @brief Remove oldest keys from bucket, so at most maxSize keys
+             * remain.
+             *
+             * Returns keys removed from index, keys itself are not removed.
+             */
+            std::vector<std::string> trim(
+                    _In_ const std::string& bucket,
+                    _In_ size_t maxSize);
+
+        private:
+
+            std::string getBucketSetName(
+                    _In_ const std::string& bucket) const;
+
+            size_t getSize(
+                    _In_ const std::string& set);
+
+            std::vector<std::string> rangeByScore(
+                    _In_ const std::string& set,
+                    _In_ const std::string& min,
+                    _In_ const std::string& max);
+
+            void rebuildIfNeeded();
+
+        private:
+
+            std::shared_ptr<swss::DBConnector> m_db;
+
+            std::string m_indexName;
+
+            std::string m_pattern;
+
+            ParseFunction m_parse;
+
+            bool m_valid;
+
+            /**
+             * @brief Cached sorted set sizes, loaded on first use of bucket.
+             */
+            std::map<std::string, size_t> m_sizes;
+    };
+}
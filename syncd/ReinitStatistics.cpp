@@ -0,0 +1,203 @@
+#include "ReinitStatistics.h"
+
+#include "meta/otai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+
+#include <inttypes.h>
+
+using namespace syncd;
+
+#define MUTEX std::lock_guard<std::mutex> _lock(m_mutex);
+
+/*
+ * Minimum interval between progress updates written to STATE DB.
+ */
+#define REINIT_STATISTICS_PUBLISH_INTERVAL std::chrono::seconds(1)
+
+ReinitStatistics::ReinitStatistics(
+        _In_ const std::string& name,
+        _In_ const std::string& dbState):
+    m_name(name),
+    m_status("running"),
+    m_objectTotal(0),
+    m_objectDone(0)
+{
+    SWSS_LOG_ENTER();
+
+    m_stateDb = std::make_shared<swss::DBConnector>(dbState, 0);
+    m_table = std::unique_ptr<swss::Table>(new swss::Table(m_stateDb.get(), SYNCD_REINIT_TABLE));
+
+    // remove fields left from previous reinit
+
+    m_table->del(m_name);
+
+    m_start = std::chrono::steady_clock::now();
+    m_phaseStart = m_start;
+    m_lastPublish = m_start;
+}
+
+void ReinitStatistics::startPhase(
+        _In_ const std::string& phase)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    endPhase();
+
+    m_phase = phase;
+    m_phaseStart = std::chrono::steady_clock::now();
+
+    SWSS_LOG_NOTICE("%s reinit phase %s started", m_name.c_str(), phase.c_str());
+
+    publish();
+}
+
+void ReinitStatistics::endPhase()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_phase.empty())
+    {
+        return;
+    }
+
+    auto duration = std::chrono::steady_clock::now() - m_phaseStart;
+
+    uint64_t ms = (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+
+    SWSS_LOG_NOTICE("%s reinit phase %s took %" PRIu64 " ms", m_name.c_str(), m_phase.c_str(), ms);
+
+    m_phaseDurations.emplace_back(m_phase, ms);
+
+    m_phase.clear();
+}
+
+void ReinitStatistics::setObjectTotal(
+        _In_ uint64_t total)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    m_objectTotal = total;
+
+    publish();
+}
+
+void ReinitStatistics::objectDone()
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    m_objectDone++;
+
+    auto now = std::chrono::steady_clock::now();
+
+    if (m_objectDone == m_objectTotal || now - m_lastPublish >= REINIT_STATISTICS_PUBLISH_INTERVAL)
+    {
+        publish();
+    }
+}
+
+void ReinitStatistics::recordVendorLatency(
+        _In_ otai_object_type_t objectType,
+        _In_ std::chrono::steady_clock::duration latency)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    m_latencies[objectType].push_back((uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+}
+
+void ReinitStatistics::setFields(
+        _In_ const std::vector<swss::FieldValueTuple>& fields)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    m_fields = fields;
+}
+
+void ReinitStatistics::finish(
+        _In_ bool success)
+{
+    MUTEX;
+
+    SWSS_LOG_ENTER();
+
+    endPhase();
+
+    m_status = success ? "done" : "failed";
+
+    publish();
+}
+
+uint64_t ReinitStatistics::percentile(
+        _In_ const std::vector<uint64_t>& sorted,
+        _In_ uint32_t percent)
+{
+    SWSS_LOG_ENTER();
+
+    if (sorted.empty())
+    {
+        return 0;
+    }
+
+    return sorted[(sorted.size() - 1) * percent / 100];
+}
+
+void ReinitStatistics::publish()
+{
+    SWSS_LOG_ENTER();
+
+    auto now = std::chrono::steady_clock::now();
+
+    m_lastPublish = now;
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("status", m_status);
+    values.emplace_back("phase", m_phase.empty() ? "none" : m_phase);
+    values.emplace_back("elapsed-ms", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(now - m_start).count()));
+    values.emplace_back("objects-total", std::to_string(m_objectTotal));
+    values.emplace_back("objects-done", std::to_string(m_objectDone));
+
+    for (auto& pd: m_phaseDurations)
+    {
+        values.emplace_back(pd.first + "-ms", std::to_string(pd.second));
+    }
+
+    for (auto& kvp: m_latencies)
+    {
+        auto sorted = kvp.second;
+
+        std::sort(sorted.begin(), sorted.end());
+
+        uint64_t total = 0;
+
+        for (auto l: sorted)
+        {
+            total += l;
+        }
+
+        auto prefix = otai_serialize_object_type(kvp.first) + "-vendor-";
+
+        values.emplace_back(prefix + "count", std::to_string(sorted.size()));
+        values.emplace_back(prefix + "total-us", std::to_string(total));
+        values.emplace_back(prefix + "p50-us", std::to_string(percentile(sorted, 50)));
+        values.emplace_back(prefix + "p90-us", std::to_string(percentile(sorted, 90)));
+        values.emplace_back(prefix + "p99-us", std::to_string(percentile(sorted, 99)));
+        values.emplace_back(prefix + "max-us", std::to_string(sorted.back()));
+    }
+
+    values.insert(values.end(), m_fields.begin(), m_fields.end());
+
+    m_table->set(m_name, values);
+}
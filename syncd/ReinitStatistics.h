@@ -0,0 +1,117 @@
+#pragma once
+
+extern "C" {
+#include "otai.h"
+}
+
+#include "swss/dbconnector.h"
+#include "swss/table.h"
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <memory>
+
+/*
+ * STATE DB table with reinit statistics.
+ */
+#define SYNCD_REINIT_TABLE "SYNCD_REINIT"
+
+namespace syncd
+{
+    /**
+     * @brief Reinit statistics published to STATE DB.
+     *
+     * Each reinit (hard, soft) writes single SYNCD_REINIT|<name> entry with
+     * current phase, duration of each finished phase, progress of object
+     * processing and vendor API latency percentiles per object type.
+     *
+     * Object progress and latencies can be recorded from multiple threads.
+     */
+    class ReinitStatistics
+    {
+        public:
+
+            ReinitStatistics(
+                    _In_ const std::string& name,
+                    _In_ const std::string& dbState);
+
+            virtual ~ReinitStatistics() = default;
+
+        public:
+
+            /**
+             * @brief Start new phase, previous phase is finished.
+             */
+            void startPhase(
+                    _In_ const std::string& phase);
+
+            void setObjectTotal(
+                    _In_ uint64_t total);
+
+            /**
+             * @brief Mark single object as processed.
+             *
+             * Progress is published at most once per second.
+             */
+            void objectDone();
+
+            void recordVendorLatency(
+                    _In_ otai_object_type_t objectType,
+                    _In_ std::chrono::steady_clock::duration latency);
+
+            /**
+             * @brief Set additional fields published with statistics.
+             */
+            void setFields(
+                    _In_ const std::vector<swss::FieldValueTuple>& fields);
+
+            /**
+             * @brief Finish last phase and publish final record.
+             */
+            void finish(
+                    _In_ bool success);
+
+        private:
+
+            void endPhase();
+
+            void publish();
+
+            static uint64_t percentile(
+                    _In_ const std::vector<uint64_t>& sorted,
+                    _In_ uint32_t percent);
+
+        private:
+
+            std::mutex m_mutex;
+
+            std::string m_name;
+
+            std::shared_ptr<swss::DBConnector> m_stateDb;
+
+            std::unique_ptr<swss::Table> m_table;
+
+            std::string m_status;
+
+            std::string m_phase;
+
+            std::chrono::steady_clock::time_point m_start;
+
+            std::chrono::steady_clock::time_point m_phaseStart;
+
+            std::chrono::steady_clock::time_point m_lastPublish;
+
+            std::vector<std::pair<std::string, uint64_t>> m_phaseDurations;
+
+            std::map<otai_object_type_t, std::vector<uint64_t>> m_latencies;
+
+            uint64_t m_objectTotal;
+
+            uint64_t m_objectDone;
+
+            std::vector<swss::FieldValueTuple> m_fields;
+    };
+}
@@ -7,7 +7,9 @@
 
 using namespace syncd;
 
-RequestShutdown::RequestShutdown()
+RequestShutdown::RequestShutdown(
+        _In_ std::shared_ptr<otairedis::ContextConfig> contextConfig):
+    m_contextConfig(contextConfig)
 {
     SWSS_LOG_ENTER();
 }
@@ -23,7 +25,7 @@ void RequestShutdown::send()
 {
     SWSS_LOG_ENTER();
 
-    swss::DBConnector db("ASIC_DB", 0);
+    swss::DBConnector db(m_contextConfig->m_dbAsic, 0);
 
     swss::NotificationProducer restartQuery(&db, SYNCD_NOTIFICATION_CHANNEL_RESTARTQUERY);
 
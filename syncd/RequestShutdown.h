@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ContextConfig.h"
+
 #include "swss/sal.h"
 
 #include <memory>
@@ -12,7 +14,8 @@ namespace syncd
     {
         public:
 
-            RequestShutdown();
+            RequestShutdown(
+                    _In_ std::shared_ptr<otairedis::ContextConfig> contextConfig);
 
             virtual ~RequestShutdown();
 
@@ -20,5 +23,8 @@ namespace syncd
 
             void send();
 
+        private:
+
+            std::shared_ptr<otairedis::ContextConfig> m_contextConfig;
     };
 }
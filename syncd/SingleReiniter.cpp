@@ -1,9 +1,13 @@
 #include <thread>
 #include <chrono>
+#include <atomic>
+#include <algorithm>
 #include "SingleReiniter.h"
 #include "VidManager.h"
 #include "NotificationHandler.h"
 #include "RedisClient.h"
+#include "AsicStateSnapshot.h"
+#include "VendorOtai.h"
 
 #include "swss/logger.h"
 
@@ -22,14 +26,18 @@ SingleReiniter::SingleReiniter(
     _In_ std::shared_ptr<NotificationHandler> handler,
     _In_ const ObjectIdMap& vidToRidMap,
     _In_ const ObjectIdMap& ridToVidMap,
-    _In_ const std::vector<std::string>& asicKeys) :
+    _In_ const std::vector<std::string>& asicKeys,
+    _In_ uint32_t concurrency,
+    _In_ std::shared_ptr<ReinitStatistics> statistics) :
     m_vendorOtai(otai),
     m_vidToRidMap(vidToRidMap),
     m_ridToVidMap(ridToVidMap),
     m_asicKeys(asicKeys),
     m_translator(translator),
     m_client(client),
-    m_handler(handler)
+    m_handler(handler),
+    m_concurrency(concurrency ? concurrency : 1),
+    m_statistics(statistics)
 {
     SWSS_LOG_ENTER();
 
@@ -52,15 +60,27 @@ std::shared_ptr<OtaiLinecard> SingleReiniter::hardReinit()
 
     SWSS_LOG_TIMER("hard reinit");
 
+    m_statistics->startPhase("snapshot-load");
+
     prepareAsicState();
 
+    m_statistics->setObjectTotal(m_oids.size());
+
+    m_statistics->startPhase("linecard-create");
+
     processLinecards();
 
+    m_statistics->startPhase("object-create");
+
     processOids();
 
     //For certain transponder and WSS linecards, notify the linecard that syncd has finished configuration
+    m_statistics->startPhase("stop-pre-config");
+
     stopPreConfigLinecards();
 
+    m_statistics->startPhase("check-ids");
+
     checkAllIds();
 
     return m_sw;
@@ -72,6 +92,10 @@ void SingleReiniter::prepareAsicState()
 
     SWSS_LOG_TIMER("read asic state m_asicKeys %d", (int)m_asicKeys.size());
 
+    AsicStateSnapshot snapshot(m_client, m_asicKeys);
+
+    m_attributesLists = snapshot.load();
+
     for (auto& key : m_asicKeys)
     {
         otai_object_type_t objectType = getObjectTypeFromAsicKey(key);
@@ -89,8 +113,6 @@ void SingleReiniter::prepareAsicState()
             m_oids[strObjectId] = key;
             break;
         }
-
-        m_attributesLists[key] = redisGetAttributesFromAsicKey(key);
     }
 }
 
@@ -275,7 +297,13 @@ void SingleReiniter::processLinecards()
 
         {
             SWSS_LOG_TIMER("create linecard");
+
+            auto start = std::chrono::steady_clock::now();
+
             status = m_vendorOtai->create(OTAI_OBJECT_TYPE_LINECARD, &m_linecard_rid, 0, attr_count, attr_list);
+
+            m_statistics->recordVendorLatency(OTAI_OBJECT_TYPE_LINECARD, std::chrono::steady_clock::now() - start);
+            m_statistics->objectDone();
         }
 
         if (status != OTAI_STATUS_SUCCESS)
@@ -449,6 +477,25 @@ otai_object_id_t SingleReiniter::processSingleVid(
         return it->second;
     }
 
+    auto list = prepareSingleVid(vid);
+
+    otai_object_id_t rid = OTAI_NULL_OBJECT_ID;
+
+    otai_status_t status = createSingleVid(vid, *list, rid);
+
+    checkCreateStatus(vid, *list, status);
+
+    m_translatedV2R[vid] = rid;
+    m_translatedR2V[rid] = vid;
+
+    return rid;
+}
+
+std::shared_ptr<OtaiAttributeList> SingleReiniter::prepareSingleVid(
+    _In_ otai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
+
     otai_object_type_t objectType = VidManager::objectTypeQuery(vid);
 
     std::string strVid = otai_serialize_object_id(vid);
@@ -460,9 +507,7 @@ otai_object_id_t SingleReiniter::processSingleVid(
         SWSS_LOG_THROW("failed to find VID %s in OIDs map", strVid.c_str());
     }
 
-    std::string asicKey = oit->second;
-
-    std::shared_ptr<OtaiAttributeList> list = m_attributesLists[asicKey];
+    std::shared_ptr<OtaiAttributeList> list = m_attributesLists[oit->second];
 
     otai_attribute_t* attrList = list->get_attr_list();
 
@@ -472,32 +517,36 @@ otai_object_id_t SingleReiniter::processSingleVid(
 
     processAttributesForOids(objectType, attrCount, attrList);
 
-    bool createObject = true;
+    if (m_vidToRidMap.find(vid) == m_vidToRidMap.end())
+    {
+        SWSS_LOG_THROW("failed to find VID %s in VIDTORID map",
+            otai_serialize_object_id(vid).c_str());
+    }
+
+    return list;
+}
+
+otai_status_t SingleReiniter::createSingleVid(
+    _In_ otai_object_id_t vid,
+    _In_ OtaiAttributeList& list,
+    _Out_ otai_object_id_t& rid)
+{
+    SWSS_LOG_ENTER();
 
     /*
-     * Now let's determine whether this object need to be created.  
-     * When object exists on the linecard it will not be
-     * created, but matched. We just need to watch for RO/CO attributes.
-     *
-     * NOTE: this also should be per linecard.
+     * Called concurrently from reinit workers, so it must not modify any
+     * reiniter members, all OID attributes are already translated.
      */
 
-    auto v2rMapIt = m_vidToRidMap.find(vid);
+    otai_object_type_t objectType = VidManager::objectTypeQuery(vid);
 
-    if (v2rMapIt == m_vidToRidMap.end())
-    {
-        SWSS_LOG_THROW("failed to find VID %s in VIDTORID map",
-            otai_serialize_object_id(vid).c_str());
-    }
+    otai_attribute_t* attrList = list.get_attr_list();
 
-    otai_object_id_t rid;
+    uint32_t attrCount = list.get_attr_count();
 
-    ///////////////////////////////////////////////////////////////////////////////////////////////////////
     uint32_t attr_count = 0;            // attr count needed for create
-    uint32_t attr_count_left = 0;       // attr count after create
 
     std::vector<otai_attribute_t> attrs;         // attrs for create
-    std::vector<otai_attribute_t> attrs_left;    // attrs for set
 
     for (uint32_t idx = 0; idx < attrCount; ++idx)
     {
@@ -507,121 +556,69 @@ otai_object_id_t SingleReiniter::processSingleVid(
         {
             /*
              * If attribute is mandatory on create or create only, we need
-             * to select it for linecard create method, since it's required
-             * on create or it will not be possible to change it after
-             * create.
-             *
-             * Currently linecard don't have any conditional attributes but
-             * we could take this into account. Even if any of those
-             * conditional attributes will present, it will be not be oid
-             * attribute.
+             * to select it for create method, since it's required on create
+             * or it will not be possible to change it after create.
              */
 
             attrs.push_back(attrList[idx]); // struct copy, we will keep the same pointers
             attr_count++;
         }
-        else
-        {
-            /*
-             * Those attributes can be OID attributes, so we need to
-             * process them after creating linecard.
-             */
-
-            attrs_left.push_back(attrList[idx]); // struct copy, we will keep the same pointers
-            attr_count_left++;
-        }
     }
-    SWSS_LOG_INFO("processSingleVid setting attributes on object of type %x, processed VID 0x%" PRIx64 " to RID 0x%" PRIx64 " attr_count %d, attr_count_left %d", objectType, vid, rid, attr_count, attr_count_left);
-    ///////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    if (createObject)
-    {
-        otai_object_meta_key_t meta_key;
 
-        meta_key.objecttype = objectType;
+    SWSS_LOG_INFO("processSingleVid creating object of type %x, VID 0x%" PRIx64 " attr_count %d, attr_count_left %d",
+            objectType, vid, attr_count, attrCount - attr_count);
 
-        /*
-         * Since we have only one linecard, we can get away using m_linecard_rid here.
-         */
-        SWSS_LOG_NOTICE("start to create object %s", otai_serialize_object_type(objectType).c_str());
-        otai_status_t status = m_vendorOtai->create(meta_key.objecttype, &meta_key.objectkey.key.object_id, m_linecard_rid, attr_count, attrs.data());
-
-        if (status != OTAI_STATUS_SUCCESS)
-        {
-            listFailedAttributes(objectType, attr_count, attrs.data());
-
-            SWSS_LOG_THROW("failed to create object %s: %s",
-                otai_serialize_object_type(objectType).c_str(),
-                otai_serialize_status(status).c_str());
-        }
-
-        rid = meta_key.objectkey.key.object_id;
-
-        SWSS_LOG_DEBUG("created object of type %s, processed VID %s to RID %s",
-            otai_serialize_object_type(objectType).c_str(),
-            otai_serialize_object_id(vid).c_str(),
-            otai_serialize_object_id(rid).c_str());
-    }
-    else
-    {
-        SWSS_LOG_DEBUG("setting attributes on object of type %x, processed VID 0x%" PRIx64 " to RID 0x%" PRIx64 " ", objectType, vid, rid);
+    otai_object_meta_key_t meta_key;
 
-        for (uint32_t idx = 0; idx < attr_count_left; idx++)
-        {
-            otai_attribute_t* attr = &attrs_left[idx];
+    meta_key.objecttype = objectType;
 
-            auto meta = otai_metadata_get_attr_metadata(objectType, attr->id);
+    /*
+     * Since we have only one linecard, we can get away using m_linecard_rid here.
+     */
+    SWSS_LOG_NOTICE("start to create object %s", otai_serialize_object_type(objectType).c_str());
 
-            if (meta == NULL)
-            {
-                SWSS_LOG_THROW("failed to get attribute metadata %s: %d",
-                    otai_serialize_object_type(objectType).c_str(),
-                    attr->id);
-            }
+    auto start = std::chrono::steady_clock::now();
 
-            if (OTAI_HAS_FLAG_CREATE_ONLY(meta->flags))
-            {
-                SWSS_LOG_WARN("skipping create only attr %s: %s",
-                    meta->attridname,
-                    otai_serialize_attr_value(*meta, *attr).c_str());
+    otai_status_t status = m_vendorOtai->create(meta_key.objecttype, &meta_key.objectkey.key.object_id, m_linecard_rid, attr_count, attrs.data());
 
-                continue;
-            }
+    m_statistics->recordVendorLatency(objectType, std::chrono::steady_clock::now() - start);
+    m_statistics->objectDone();
 
-#ifdef ENABLE_PERF
-            auto start = std::chrono::high_resolution_clock::now();
-#endif
-            SWSS_LOG_NOTICE("start to set object %s: %s", 
-                otai_serialize_object_type(objectType).c_str(),
-                otai_serialize_attr_value(*meta, *attr).c_str());
-            otai_status_t status = m_vendorOtai->set(objectType, rid, attr);
+    if (status != OTAI_STATUS_SUCCESS)
+    {
+        return status;
+    }
 
-#ifdef ENABLE_PERF
-            auto end = std::chrono::high_resolution_clock::now();
+    rid = meta_key.objectkey.key.object_id;
 
-            typedef std::chrono::duration<double, std::ratio<1>> second_t;
+    SWSS_LOG_DEBUG("created object of type %s, processed VID %s to RID %s",
+        otai_serialize_object_type(objectType).c_str(),
+        otai_serialize_object_id(vid).c_str(),
+        otai_serialize_object_id(rid).c_str());
 
-            double duration = std::chrono::duration_cast<second_t>(end - start).count();
+    return status;
+}
 
-            std::get<0>(m_perf_set[objectType])++;
-            std::get<1>(m_perf_set[objectType]) += duration;
-#endif
+void SingleReiniter::checkCreateStatus(
+    _In_ otai_object_id_t vid,
+    _In_ OtaiAttributeList& list,
+    _In_ otai_status_t status)
+{
+    SWSS_LOG_ENTER();
 
-            if (status != OTAI_STATUS_SUCCESS)
-            {
-                SWSS_LOG_ERROR(
-                    "failed to set %s value %s: %s",
-                    meta->attridname,
-                    otai_serialize_attr_value(*meta, *attr).c_str(),
-                    otai_serialize_status(status).c_str());
-            }
-        }
+    if (status == OTAI_STATUS_SUCCESS)
+    {
+        return;
     }
 
-    m_translatedV2R[vid] = rid;
-    m_translatedR2V[rid] = vid;
+    otai_object_type_t objectType = VidManager::objectTypeQuery(vid);
 
-    return rid;
+    listFailedAttributes(objectType, list.get_attr_count(), list.get_attr_list());
+
+    SWSS_LOG_THROW("failed to create object %s VID %s: %s",
+        otai_serialize_object_type(objectType).c_str(),
+        otai_serialize_object_id(vid).c_str(),
+        otai_serialize_status(status).c_str());
 }
 
 void SingleReiniter::processAttributesForOids(
@@ -693,18 +690,257 @@ void SingleReiniter::processAttributesForOids(
     }
 }
 
-void SingleReiniter::processOids()
+std::set<otai_object_id_t> SingleReiniter::getObjectDependencies(
+    _In_ otai_object_id_t vid)
 {
     SWSS_LOG_ENTER();
 
-    for (const auto& kv : m_oids)
+    otai_object_type_t objectType = VidManager::objectTypeQuery(vid);
+
+    std::string strVid = otai_serialize_object_id(vid);
+
+    auto oit = m_oids.find(strVid);
+
+    if (oit == m_oids.end())
+    {
+        SWSS_LOG_THROW("failed to find VID %s in OIDs map", strVid.c_str());
+    }
+
+    auto& list = m_attributesLists[oit->second];
+
+    const otai_attribute_t* attrList = list->get_attr_list();
+
+    uint32_t attrCount = list->get_attr_count();
+
+    std::set<otai_object_id_t> deps;
+
+    for (uint32_t idx = 0; idx < attrCount; idx++)
     {
-        const std::string& strObjectId = kv.first;
+        auto meta = otai_metadata_get_attr_metadata(objectType, attrList[idx].id);
+
+        if (meta == NULL)
+        {
+            SWSS_LOG_THROW("unable to get metadata for object type %s, attribute %d",
+                otai_serialize_object_type(objectType).c_str(),
+                attrList[idx].id);
+        }
+
+        uint32_t count = 0;
+        const otai_object_id_t* objectIdList = NULL;
+
+        switch (meta->attrvaluetype)
+        {
+        case OTAI_ATTR_VALUE_TYPE_OBJECT_ID:
+            count = 1;
+            objectIdList = &attrList[idx].value.oid;
+            break;
 
+        case OTAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+            count = attrList[idx].value.objlist.count;
+            objectIdList = attrList[idx].value.objlist.list;
+            break;
+
+        default:
+            continue;
+        }
+
+        for (uint32_t j = 0; j < count; j++)
+        {
+            otai_object_id_t dep = objectIdList[j];
+
+            if (dep == OTAI_NULL_OBJECT_ID || dep == vid || m_translatedV2R.find(dep) != m_translatedV2R.end())
+            {
+                continue;
+            }
+
+            if (m_oids.find(otai_serialize_object_id(dep)) == m_oids.end())
+            {
+                SWSS_LOG_THROW("VID %s referenced by %s not found in OIDs map",
+                    otai_serialize_object_id(dep).c_str(),
+                    strVid.c_str());
+            }
+
+            deps.insert(dep);
+        }
+    }
+
+    return deps;
+}
+
+std::vector<std::vector<otai_object_id_t>> SingleReiniter::getCreateLevels()
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Objects are grouped into levels, each object depends only on objects
+     * from previous levels, so objects inside single level can be created
+     * concurrently. Ordered containers are used so levels are the same on
+     * every run.
+     */
+
+    std::map<otai_object_id_t, std::set<otai_object_id_t>> pending;
+
+    for (const auto& kv : m_oids)
+    {
         otai_object_id_t vid;
-        otai_deserialize_object_id(strObjectId, vid);
+        otai_deserialize_object_id(kv.first, vid);
+
+        if (m_translatedV2R.find(vid) != m_translatedV2R.end())
+        {
+            continue;
+        }
+
+        pending[vid] = getObjectDependencies(vid);
+    }
+
+    std::vector<std::vector<otai_object_id_t>> levels;
+
+    std::set<otai_object_id_t> done;
+
+    while (pending.size())
+    {
+        std::vector<otai_object_id_t> level;
+
+        for (const auto& kv : pending)
+        {
+            bool ready = true;
+
+            for (auto dep : kv.second)
+            {
+                if (done.find(dep) == done.end())
+                {
+                    ready = false;
+                    break;
+                }
+            }
+
+            if (ready)
+            {
+                level.push_back(kv.first);
+            }
+        }
+
+        if (level.empty())
+        {
+            for (const auto& kv : pending)
+            {
+                SWSS_LOG_ERROR("unresolved VID %s with %zu dependencies",
+                    otai_serialize_object_id(kv.first).c_str(),
+                    kv.second.size());
+            }
+
+            SWSS_LOG_THROW("dependency cycle between %zu objects, can't reinit", pending.size());
+        }
+
+        for (auto vid : level)
+        {
+            pending.erase(vid);
+            done.insert(vid);
+        }
 
-        processSingleVid(vid);
+        levels.push_back(level);
+    }
+
+    return levels;
+}
+
+void SingleReiniter::processLevel(
+    _In_ const std::vector<otai_object_id_t>& level)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("create %zu objects", level.size());
+
+    // translation of OID attributes modifies reiniter maps, do it serially
+
+    std::vector<std::shared_ptr<OtaiAttributeList>> lists;
+
+    for (auto vid : level)
+    {
+        lists.push_back(prepareSingleVid(vid));
+    }
+
+    std::vector<otai_object_id_t> rids(level.size(), OTAI_NULL_OBJECT_ID);
+    std::vector<otai_status_t> statuses(level.size(), OTAI_STATUS_FAILURE);
+
+    std::atomic<size_t> next(0);
+
+    auto worker = [&]()
+    {
+        for (size_t idx = next++; idx < level.size(); idx = next++)
+        {
+            try
+            {
+                statuses[idx] = createSingleVid(level[idx], *lists[idx], rids[idx]);
+            }
+            catch (const std::exception& e)
+            {
+                SWSS_LOG_ERROR("exception while creating VID %s: %s",
+                    otai_serialize_object_id(level[idx]).c_str(),
+                    e.what());
+
+                statuses[idx] = OTAI_STATUS_FAILURE;
+            }
+        }
+    };
+
+    size_t workers = std::min<size_t>(m_concurrency, level.size());
+
+    if (workers <= 1)
+    {
+        worker();
+    }
+    else
+    {
+        // concurrency above 1 is allowed only with thread safe vendor
+        // library, vendor API calls from workers are not serialized, calls
+        // from other threads still are
+
+        std::vector<std::thread> threads;
+
+        for (size_t idx = 0; idx < workers; idx++)
+        {
+            threads.emplace_back([&]()
+            {
+                VendorOtaiConcurrencyScope scope(m_vendorOtai);
+
+                worker();
+            });
+        }
+
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+    }
+
+    /*
+     * Results are checked in level order, so when multiple objects fail, the
+     * reported error is the same regardless of completion order.
+     */
+
+    for (size_t idx = 0; idx < level.size(); idx++)
+    {
+        checkCreateStatus(level[idx], *lists[idx], statuses[idx]);
+
+        m_translatedV2R[level[idx]] = rids[idx];
+        m_translatedR2V[rids[idx]] = level[idx];
+    }
+}
+
+void SingleReiniter::processOids()
+{
+    SWSS_LOG_ENTER();
+
+    auto levels = getCreateLevels();
+
+    SWSS_LOG_NOTICE("creating objects in %zu dependency levels, concurrency %u",
+        levels.size(),
+        m_concurrency);
+
+    for (const auto& level : levels)
+    {
+        processLevel(level);
     }
 }
 
@@ -749,30 +985,6 @@ SingleReiniter::ObjectIdMap SingleReiniter::getTranslatedVid2Rid() const
     return m_translatedV2R;
 }
 
-std::shared_ptr<OtaiAttributeList> SingleReiniter::redisGetAttributesFromAsicKey(
-    _In_ const std::string& key)
-{
-    SWSS_LOG_ENTER();
-
-    otai_object_type_t objectType = getObjectTypeFromAsicKey(key);
-
-    std::vector<swss::FieldValueTuple> values;
-
-    auto hash = m_client->getAttributesFromAsicKey(key);
-
-    for (auto& kv : hash)
-    {
-        const std::string& skey = kv.first;
-        const std::string& svalue = kv.second;
-
-        swss::FieldValueTuple fvt(skey, svalue);
-
-        values.push_back(fvt);
-    }
-
-    return std::make_shared<OtaiAttributeList>(objectType, values, false);
-}
-
 std::shared_ptr<OtaiLinecard> SingleReiniter::getLinecard() const
 {
     SWSS_LOG_ENTER();
@@ -4,6 +4,7 @@
 #include "VirtualOidTranslator.h"
 #include "RedisClient.h"
 #include "NotificationHandler.h"
+#include "ReinitStatistics.h"
 
 #include "meta/OtaiInterface.h"
 
@@ -13,11 +14,19 @@
 #include <string>
 #include <unordered_map>
 #include <map>
+#include <set>
 #include <vector>
 #include <memory>
 
 namespace syncd
 {
+    /**
+     * @brief Recreates objects from ASIC DB on hard reinit.
+     *
+     * Linecard is created first, then remaining objects are created in
+     * dependency order derived from OID attributes, independent objects are
+     * created by bounded number of worker threads.
+     */
     class SingleReiniter
     {
     public:
@@ -34,7 +43,9 @@ namespace syncd
             _In_ std::shared_ptr<NotificationHandler> handler,
             _In_ const ObjectIdMap& vidToRidMap,
             _In_ const ObjectIdMap& ridToVidMap,
-            _In_ const std::vector<std::string>& asicKeys);
+            _In_ const std::vector<std::string>& asicKeys,
+            _In_ uint32_t concurrency,
+            _In_ std::shared_ptr<ReinitStatistics> statistics);
 
         virtual ~SingleReiniter();
 
@@ -67,8 +78,35 @@ namespace syncd
         otai_object_id_t processSingleVid(
             _In_ otai_object_id_t vid);
 
-        std::shared_ptr<otaimeta::OtaiAttributeList> redisGetAttributesFromAsicKey(
-            _In_ const std::string& key);
+        std::shared_ptr<otaimeta::OtaiAttributeList> prepareSingleVid(
+            _In_ otai_object_id_t vid);
+
+        otai_status_t createSingleVid(
+            _In_ otai_object_id_t vid,
+            _In_ otaimeta::OtaiAttributeList& list,
+            _Out_ otai_object_id_t& rid);
+
+        void checkCreateStatus(
+            _In_ otai_object_id_t vid,
+            _In_ otaimeta::OtaiAttributeList& list,
+            _In_ otai_status_t status);
+
+        /**
+         * @brief Get not yet translated VIDs referenced by object attributes.
+         */
+        std::set<otai_object_id_t> getObjectDependencies(
+            _In_ otai_object_id_t vid);
+
+        /**
+         * @brief Group objects into dependency levels.
+         *
+         * Objects in single level don't depend on each other and can be
+         * created concurrently.
+         */
+        std::vector<std::vector<otai_object_id_t>> getCreateLevels();
+
+        void processLevel(
+            _In_ const std::vector<otai_object_id_t>& level);
 
         void processAttributesForOids(
             _In_ otai_object_type_t objectType,
@@ -105,9 +143,6 @@ namespace syncd
 
         std::unordered_map<std::string, std::shared_ptr<otaimeta::OtaiAttributeList>> m_attributesLists;
 
-        std::map<otai_object_type_t, std::tuple<int, double>> m_perf_create;
-        std::map<otai_object_type_t, std::tuple<int, double>> m_perf_set;
-
         otai_object_id_t m_linecard_rid;
         otai_object_id_t m_linecard_vid;
 
@@ -118,5 +153,12 @@ namespace syncd
         std::shared_ptr<RedisClient> m_client;
 
         std::shared_ptr<NotificationHandler> m_handler;
+
+        /**
+         * @brief Maximum number of concurrent vendor create calls.
+         */
+        uint32_t m_concurrency;
+
+        std::shared_ptr<ReinitStatistics> m_statistics;
     };
 }
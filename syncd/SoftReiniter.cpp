@@ -6,6 +6,7 @@
 #include "FlexCounterReiniter.h"
 #include "VidManager.h"
 #include "RedisClient.h"
+#include "AsicStateSnapshot.h"
 #include "swss/logger.h"
 #include "meta/otai_serialize.h"
 
@@ -17,13 +18,21 @@ SoftReiniter::SoftReiniter(
     _In_ shared_ptr<RedisClient> client,
     _In_ std::shared_ptr<VirtualOidTranslator> translator,
     _In_ std::shared_ptr<otairedis::OtaiInterface> otai,
-    _In_ std::shared_ptr<FlexCounterManager> manager):
+    _In_ std::shared_ptr<FlexCounterManager> manager,
+    _In_ const std::string& dbState,
+    _In_ bool diffOnly):
     m_vendorOtai(otai),
     m_translator(translator),
     m_client(client),
-    m_manager(manager)
+    m_manager(manager),
+    m_diffOnly(diffOnly),
+    m_unchanged(0),
+    m_updated(0),
+    m_reapplied(0)
 {
     SWSS_LOG_ENTER();
+
+    m_statistics = make_shared<ReinitStatistics>("SOFT", dbState);
 }
 
 SoftReiniter::~SoftReiniter()
@@ -40,6 +49,8 @@ void SoftReiniter::readAsicState()
     m_vidToRidMap = m_client->getVidToRidMap();
     m_ridToVidMap = m_client->getRidToVidMap();
 
+    m_translator->preload(m_vidToRidMap, m_ridToVidMap);
+
     for (auto& v2r: m_vidToRidMap) {
         auto linecardId = VidManager::linecardIdQuery(v2r.first);
         m_linecardVidToRid[linecardId][v2r.first] = v2r.second;
@@ -75,6 +86,12 @@ void SoftReiniter::prepareAsicState(vector<string> &asicKeys)
 
     SWSS_LOG_TIMER("read asic state asicKeys %d", (int)asicKeys.size());
 
+    AsicStateSnapshot snapshot(m_client, asicKeys);
+
+    for (auto& kv: snapshot.load()) {
+        m_attributesLists[kv.first] = kv.second;
+    }
+
     for (auto &key : asicKeys) {
         otai_object_type_t objectType = getObjectTypeFromAsicKey(key);
         const string& strObjectId = getObjectIdFromAsicKey(key);
@@ -91,7 +108,6 @@ void SoftReiniter::prepareAsicState(vector<string> &asicKeys)
             m_oids[strObjectId] = key;
             break;
         }
-        m_attributesLists[key] = redisGetAttributesFromAsicKey(key);
     }
 }
 
@@ -300,6 +316,21 @@ otai_object_id_t SoftReiniter::processSingleVid(_In_ otai_object_id_t vid)
             attr_count_left++;
         }
     }
+    if (m_diffOnly) {
+        bool readable = true;
+        attrs_left = getChangedAttributes(objectType, rid, attrs_left, readable);
+        attr_count_left = (uint32_t)attrs_left.size();
+
+        if (!readable) {
+            m_reapplied++;
+        } else if (attr_count_left == 0) {
+            m_unchanged++;
+        } else {
+            m_updated++;
+        }
+    } else {
+        m_reapplied++;
+    }
     SWSS_LOG_DEBUG("setting attributes on object of type %x, processed VID 0x%" PRIx64 " to RID 0x%" PRIx64 " ", objectType, vid, rid);
     for (uint32_t idx = 0; idx < attr_count_left; idx++) {
         otai_attribute_t* attr = &attrs_left[idx];
@@ -310,7 +341,9 @@ otai_object_id_t SoftReiniter::processSingleVid(_In_ otai_object_id_t vid)
                 attr->id);
         }
         SWSS_LOG_NOTICE("set %s attr, attr_id=%s", otai_serialize_object_type(objectType).c_str(), otai_serialize_attr_id(*meta).c_str());
+        auto start = chrono::steady_clock::now();
         otai_status_t status = m_vendorOtai->set(objectType, rid, attr);
+        m_statistics->recordVendorLatency(objectType, chrono::steady_clock::now() - start);
         if (status != OTAI_STATUS_SUCCESS)
         {
             SWSS_LOG_ERROR(
@@ -323,9 +356,135 @@ otai_object_id_t SoftReiniter::processSingleVid(_In_ otai_object_id_t vid)
     m_translatedV2R[vid] = rid;
     m_translatedR2V[rid] = vid;
 
+    m_statistics->objectDone();
+
     return rid;
 }
 
+bool SoftReiniter::isAttributeChanged(
+    _In_ otai_object_type_t objectType,
+    _In_ otai_object_id_t rid,
+    _In_ const swss::FieldValueTuple& value,
+    _Out_ bool& readable)
+{
+    SWSS_LOG_ENTER();
+
+    // list is deserialized from ASIC DB value, so list buffers have the size
+    // of expected value
+
+    otaimeta::OtaiAttributeList current(objectType, vector<swss::FieldValueTuple>{ value }, false);
+
+    otai_attribute_t* attr = current.get_attr_list();
+
+    otai_status_t status = m_vendorOtai->get(objectType, rid, 1, attr);
+    if (status != OTAI_STATUS_SUCCESS) {
+        readable = false;
+        return true;
+    }
+
+    readable = true;
+
+    auto meta = otai_metadata_get_attr_metadata(objectType, attr->id);
+
+    return otai_serialize_attr_value(*meta, *attr) != fvValue(value);
+}
+
+vector<otai_attribute_t> SoftReiniter::getChangedAttributes(
+    _In_ otai_object_type_t objectType,
+    _In_ otai_object_id_t rid,
+    _In_ const vector<otai_attribute_t>& attrs,
+    _Out_ bool& readable)
+{
+    SWSS_LOG_ENTER();
+
+    vector<otai_attribute_t> changed;
+    vector<otai_attribute_t> candidates;
+    vector<swss::FieldValueTuple> values;
+
+    readable = true;
+
+    for (auto& attr: attrs) {
+        auto meta = otai_metadata_get_attr_metadata(objectType, attr.id);
+
+        switch (meta->attrvaluetype) {
+        case OTAI_ATTR_VALUE_TYPE_OBJECT_ID:
+        case OTAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+        case OTAI_ATTR_VALUE_TYPE_POINTER:
+            // ASIC DB holds VIDs and syncd pointers, they can't be compared
+            // with values returned by vendor, always apply them
+            changed.push_back(attr);
+            break;
+
+        default:
+            candidates.push_back(attr);
+            values.emplace_back(otai_serialize_attr_id(*meta), otai_serialize_attr_value(*meta, attr));
+            break;
+        }
+    }
+
+    if (candidates.empty()) {
+        return changed;
+    }
+
+    // try to read all attributes with single call first
+
+    otaimeta::OtaiAttributeList current(objectType, values, false);
+
+    otai_status_t status = m_vendorOtai->get(objectType, rid, current.get_attr_count(), current.get_attr_list());
+
+    if (status == OTAI_STATUS_SUCCESS) {
+        otai_attribute_t* list = current.get_attr_list();
+
+        for (size_t idx = 0; idx < candidates.size(); idx++) {
+            auto meta = otai_metadata_get_attr_metadata(objectType, list[idx].id);
+
+            if (otai_serialize_attr_value(*meta, list[idx]) != fvValue(values[idx])) {
+                changed.push_back(candidates[idx]);
+            }
+        }
+
+        return changed;
+    }
+
+    // some attribute is not readable or list size differs, check one by one
+
+    bool anyReadable = false;
+
+    for (size_t idx = 0; idx < candidates.size(); idx++) {
+        bool attrReadable = false;
+
+        if (isAttributeChanged(objectType, rid, values[idx], attrReadable)) {
+            changed.push_back(candidates[idx]);
+        }
+
+        anyReadable |= attrReadable;
+    }
+
+    if (!anyReadable) {
+        SWSS_LOG_WARN("unable to read any attribute of %s RID 0x%" PRIx64 ", reapplying all",
+            otai_serialize_object_type(objectType).c_str(), rid);
+
+        readable = false;
+        return attrs;
+    }
+
+    return changed;
+}
+
+vector<swss::FieldValueTuple> SoftReiniter::getStatistics() const
+{
+    SWSS_LOG_ENTER();
+
+    vector<swss::FieldValueTuple> stats;
+
+    stats.emplace_back("mode", m_diffOnly ? "diff" : "full");
+    stats.emplace_back("unchanged", to_string(m_unchanged));
+    stats.emplace_back("updated", to_string(m_updated));
+    stats.emplace_back("reapplied", to_string(m_reapplied));
+
+    return stats;
+}
+
 void SoftReiniter::processOids()
 {
     SWSS_LOG_ENTER();
@@ -343,15 +502,47 @@ void SoftReiniter::softReinit()
 {
     SWSS_LOG_ENTER();
 
+    try {
+        softReinitInternal();
+
+        m_statistics->setFields(getStatistics());
+        m_statistics->finish(true);
+    } catch (const std::exception&) {
+        m_statistics->setFields(getStatistics());
+        m_statistics->finish(false);
+
+        throw;
+    }
+}
+
+void SoftReiniter::softReinitInternal()
+{
+    SWSS_LOG_ENTER();
+
+    m_statistics->startPhase("read-maps");
+
     readAsicState();
 
     for (auto& kvp: m_linecardMap) {
+        m_statistics->startPhase("snapshot-load");
         prepareAsicState(kvp.second); 
+        m_statistics->setObjectTotal(m_oids.size());
+
+        m_statistics->startPhase("linecard-apply");
         processLinecards();
+
+        m_statistics->startPhase("object-apply");
         processOids();
+
+        m_statistics->startPhase("stop-pre-config");
         stopPreConfigLinecards();
     }
 
+    SWSS_LOG_NOTICE("soft reinit objects unchanged %u, updated %u, reapplied %u",
+        m_unchanged, m_updated, m_reapplied);
+
+    m_statistics->startPhase("flex-counter-group-restore");
+
     auto flexCounterGroupKeys = m_client->getFlexCounterGroupKeys();
     auto flexCounterKeys = m_client->getFlexCounterKeys();
 
@@ -362,6 +553,8 @@ void SoftReiniter::softReinit()
 
     fgr->hardReinit();
 
+    m_statistics->startPhase("flex-counter-restore");
+
     for (auto& kvp: m_linecardMap)
     {
         auto fr = std::make_shared<FlexCounterReiniter>(
@@ -409,23 +602,3 @@ string SoftReiniter::getObjectIdFromAsicKey(
 
     return key.substr(end + 1);
 }
-
-shared_ptr<otaimeta::OtaiAttributeList> SoftReiniter::redisGetAttributesFromAsicKey(
-    _In_ const string& key)
-{
-    SWSS_LOG_ENTER();
-
-    otai_object_type_t objectType = getObjectTypeFromAsicKey(key);
-
-    vector<swss::FieldValueTuple> values;
-
-    auto hash = m_client->getAttributesFromAsicKey(key);
-    for (auto& kv : hash) {
-        const string& skey = kv.first;
-        const string& svalue = kv.second;
-        swss::FieldValueTuple fvt(skey, svalue);
-        values.push_back(fvt);
-    }
-    return make_shared<otaimeta::OtaiAttributeList>(objectType, values, false);
-}
-
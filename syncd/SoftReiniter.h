@@ -6,6 +6,7 @@
 #include "RedisClient.h"
 #include "NotificationHandler.h"
 #include "FlexCounterManager.h"
+#include "ReinitStatistics.h"
 #include "meta/OtaiAttributeList.h"
 
 #include <string>
@@ -18,6 +19,12 @@ using namespace std;
 
 namespace syncd
 {
+    /**
+     * @brief Reapplies ASIC DB configuration when linecard becomes active.
+     *
+     * In diff only mode, current hardware values of settable attributes are
+     * read first and only attributes which differ from ASIC DB are set.
+     */
     class SoftReiniter
     {
         public:
@@ -29,7 +36,9 @@ namespace syncd
                 _In_ shared_ptr<RedisClient> client,
                 _In_ std::shared_ptr<VirtualOidTranslator> translator,
                 _In_ std::shared_ptr<otairedis::OtaiInterface> otai,
-                _In_ std::shared_ptr<FlexCounterManager> manager
+                _In_ std::shared_ptr<FlexCounterManager> manager,
+                _In_ const std::string& dbState,
+                _In_ bool diffOnly
             );
             virtual ~SoftReiniter();
             void readAsicState();
@@ -37,12 +46,30 @@ namespace syncd
             void softReinit();
             otai_object_type_t getObjectTypeFromAsicKey(_In_ const string& key);
             string getObjectIdFromAsicKey(_In_ const string& key);
-            shared_ptr<otaimeta::OtaiAttributeList> redisGetAttributesFromAsicKey(_In_ const string& key);
             void processLinecards();
             void stopPreConfigLinecards();
             void processOids();
             otai_object_id_t processSingleVid(_In_ otai_object_id_t vid);
             void setBoardMode(std::string mode);
+
+            /**
+             * @brief Get number of unchanged, updated and reapplied objects.
+             */
+            vector<swss::FieldValueTuple> getStatistics() const;
+        private:
+            void softReinitInternal();
+
+            vector<otai_attribute_t> getChangedAttributes(
+                _In_ otai_object_type_t objectType,
+                _In_ otai_object_id_t rid,
+                _In_ const vector<otai_attribute_t>& attrs,
+                _Out_ bool& readable);
+
+            bool isAttributeChanged(
+                _In_ otai_object_type_t objectType,
+                _In_ otai_object_id_t rid,
+                _In_ const swss::FieldValueTuple& value,
+                _Out_ bool& readable);
         private:
             std::shared_ptr<otairedis::OtaiInterface> m_vendorOtai;
 
@@ -64,5 +91,13 @@ namespace syncd
             std::shared_ptr<VirtualOidTranslator> m_translator;
             shared_ptr<RedisClient> m_client;
             std::shared_ptr<FlexCounterManager> m_manager;
+
+            bool m_diffOnly;
+
+            uint32_t m_unchanged;
+            uint32_t m_updated;
+            uint32_t m_reapplied;
+
+            shared_ptr<ReinitStatistics> m_statistics;
     };
 }
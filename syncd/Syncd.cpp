@@ -3,6 +3,8 @@
 #include "NotificationHandler.h"
 #include "HardReiniter.h"
 #include "SoftReiniter.h"
+#include "WarmReiniter.h"
+#include "AsicStateJournal.h"
 #include "RedisClient.h"
 #include "RequestShutdown.h"
 #include "RedisNotificationProducer.h"
@@ -10,6 +12,8 @@
 
 #include "otairediscommon.h"
 
+#include "lib/Utils.h"
+
 #include "swss/logger.h"
 #include "swss/select.h"
 #include "swss/tokenize.h"
@@ -38,6 +42,7 @@ Syncd::Syncd(
     m_commandLineOptions(cmd),
     m_vendorOtai(vendorOtai),
     m_linecard(nullptr),
+    m_requestId(0),
     m_linecardState(OTAI_OPER_STATUS_INACTIVE)
 {
     SWSS_LOG_ENTER();
@@ -45,16 +50,30 @@ Syncd::Syncd(
     setOtaiApiLogLevel();
     SWSS_LOG_NOTICE("command line: %s", m_commandLineOptions->getCommandLineString().c_str());
 
+    auto ccc = otairedis::ContextConfigContainer::loadFromFile(m_commandLineOptions->m_contextConfig.c_str());
+
+    m_contextConfig = ccc->get(m_commandLineOptions->m_globalContext);
+
+    if (m_contextConfig == nullptr)
+    {
+        SWSS_LOG_THROW("no context config defined at global context %u", m_commandLineOptions->m_globalContext);
+    }
+
     //flexcounters
-    m_dbFlexCounter = std::make_shared<swss::DBConnector>("FLEX_COUNTER_DB", 0);
+    m_dbFlexCounter = std::make_shared<swss::DBConnector>(m_contextConfig->m_dbFlex, 0);
     m_flexCounterGroup = std::make_shared<swss::ConsumerTable>(m_dbFlexCounter.get(), FLEX_COUNTER_GROUP_TABLE);
     m_flexCounter = std::make_shared<swss::ConsumerTable>(m_dbFlexCounter.get(), FLEX_COUNTER_TABLE);
-    m_manager = std::make_shared<FlexCounterManager>(m_vendorOtai, "COUNTERS_DB");
+    m_manager = std::make_shared<FlexCounterManager>(m_vendorOtai, m_contextConfig);
 
-    m_dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    m_dbAsic = std::make_shared<swss::DBConnector>(m_contextConfig->m_dbAsic, 0);
     m_client = std::make_shared<RedisClient>(m_dbAsic, m_dbFlexCounter);
 
-    m_state_db = std::shared_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
+    if (m_commandLineOptions->m_journalDirectory.size())
+    {
+        m_journal = std::make_shared<AsicStateJournal>(m_commandLineOptions->m_journalDirectory, m_client);
+    }
+
+    m_state_db = std::shared_ptr<DBConnector>(new DBConnector(m_contextConfig->m_dbState, 0));
     m_linecardtable = std::unique_ptr<Table>(new Table(m_state_db.get(), "LINECARD"));
 
     //Quad Events
@@ -65,9 +84,16 @@ Syncd::Syncd(
         false);
 
     //Notifications
-    m_notifications = std::make_shared<RedisNotificationProducer>("ASIC_DB");
-    m_processor = std::make_shared<NotificationProcessor>(m_notifications, m_client, std::bind(&Syncd::syncProcessNotification, this, _1));
-    m_handler = std::make_shared<NotificationHandler>(m_processor);
+    m_notifications = std::make_shared<RedisNotificationProducer>(m_contextConfig->m_dbAsic);
+    m_processor = std::make_shared<NotificationProcessor>(m_notifications, m_client, m_contextConfig, std::bind(&Syncd::syncProcessNotification, this, _1));
+    m_processor->setOcmCompactEncoding(m_commandLineOptions->m_ocmCompactEncoding);
+    m_processor->setOtdrTraceEncoding(m_commandLineOptions->m_otdrTraceEncoding);
+
+    if (m_commandLineOptions->m_alarmDampingConfig.size())
+    {
+        m_processor->setAlarmDampingConfig(m_commandLineOptions->m_alarmDampingConfig);
+    }
+    m_handler = std::make_shared<NotificationHandler>(m_processor, m_contextConfig->m_dbState);
     m_ln.onLinecardStateChange = std::bind(&NotificationHandler::onLinecardStateChange, m_handler.get(), _1, _2);
     m_ln.onLinecardAlarm = std::bind(&NotificationHandler::onLinecardAlarm, m_handler.get(), _1, _2, _3);
     m_ln.onApsReportSwitchInfo = std::bind(&NotificationHandler::onApsReportSwitchInfo, m_handler.get(), _1, _2);
@@ -122,9 +148,24 @@ void Syncd::processEvent(
 
         consumer.pop(kco);
 
+        kfvKey(kco) = otairedis::Utils::splitRequestId(kfvKey(kco), m_requestId);
+
         processSingleEvent(kco);
     }
     while (!consumer.empty());
+
+    if (m_journal)
+    {
+        // group commit, records are synced once per burst of requests
+        // instead of once per request
+
+        m_journal->commit();
+
+        if (m_journal->isSnapshotNeeded())
+        {
+            m_journal->snapshot();
+        }
+    }
 }
 
 otai_status_t Syncd::processSingleEvent(
@@ -231,6 +272,11 @@ void Syncd::sendApiResponse(
         otai_serialize_common_api(api).c_str(),
         strStatus.c_str());
 
+    if (m_requestId)
+    {
+        strStatus = otairedis::Utils::joinRequestId(strStatus, m_requestId);
+    }
+
     m_selectableChannel->set(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 
     SWSS_LOG_INFO("response for %s api was send",
@@ -256,10 +302,14 @@ void Syncd::processFlexCounterGroupEvent( // TODO must be moved to go via ASIC c
 
     if (op == SET_COMMAND)
     {
+        m_client->insertFlexCounterGroupKey(groupName);
+
         m_manager->addCounterPlugin(groupName, values);
     }
     else if (op == DEL_COMMAND)
     {
+        m_client->removeFlexCounterGroupKey(groupName);
+
         m_manager->removeCounterPlugins(groupName);
     }
     else
@@ -291,6 +341,18 @@ void Syncd::processFlexCounterEvent( // TODO must be moved to go via ASIC channe
         return; // if key is invalid there is no need to process this event again
     }
 
+    // key index must follow table content, which is driven by original
+    // operation, not by operation forced below
+
+    if (op == SET_COMMAND)
+    {
+        m_client->insertFlexCounterKey(key);
+    }
+    else if (op == DEL_COMMAND)
+    {
+        m_client->removeFlexCounterKey(key);
+    }
+
     auto groupName = key.substr(0, delimiter);
     auto strVid = key.substr(delimiter + 1);
 
@@ -353,11 +415,21 @@ void Syncd::syncUpdateRedisQuadEvent(
     {
     case OTAI_COMMON_API_CREATE:
     {
+        if (m_journal)
+        {
+            m_journal->create(metaKey, m_translator->translateVidToRid(metaKey.objectkey.key.object_id), values);
+        }
+
         m_client->createAsicObject(metaKey, values);
         break;
     }
     case OTAI_COMMON_API_REMOVE:
     {
+        if (m_journal)
+        {
+            m_journal->remove(metaKey);
+        }
+
         m_client->removeAsicObject(metaKey);
         break;
     }
@@ -380,6 +452,11 @@ void Syncd::syncUpdateRedisQuadEvent(
             break;
         }
 
+        if (m_journal)
+        {
+            m_journal->set(metaKey, attr, value);
+        }
+
         m_client->setAsicObject(metaKey, attr, value);
         break;
     }
@@ -598,6 +675,18 @@ otai_status_t Syncd::processOidCreate(
         {
             m_translator->eraseRidAndVid(objectRid, objectVidOld);
 
+            m_processor->invalidateObjectName(objectVidOld);
+
+            if (m_journal)
+            {
+                otai_object_meta_key_t metaKeyOld;
+
+                metaKeyOld.objecttype = VidManager::objectTypeQuery(objectVidOld);
+                metaKeyOld.objectkey.key.object_id = objectVidOld;
+
+                m_journal->remove(metaKeyOld);
+            }
+
             m_client->removeAsicObject(objectVidOld);
         }
 
@@ -645,6 +734,8 @@ otai_status_t Syncd::processOidRemove(
 
         m_translator->eraseRidAndVid(rid, objectVid);
 
+        m_processor->invalidateObjectName(objectVid);
+
         if (objectType == OTAI_OBJECT_TYPE_LINECARD)
         {
             /*
@@ -848,11 +939,17 @@ void Syncd::sendGetResponse(
     SWSS_LOG_INFO("sending response for GET api with status: %s", strStatus.c_str());
 
     /*
-     * Since we have only one get at a time, we don't have to serialize object
-     * type and object id, only get status is required to be returned.  Get
-     * response will not put any data to table, only queue is used.
+     * We don't have to serialize object type and object id, only get status
+     * and request id are required to be returned, since otairedis is
+     * matching responses by request id. Get response will not put any data
+     * to table, only queue is used.
      */
 
+    if (m_requestId)
+    {
+        strStatus = otairedis::Utils::joinRequestId(strStatus, m_requestId);
+    }
+
     m_selectableChannel->set(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 
     SWSS_LOG_INFO("response for GET api was send");
@@ -867,10 +964,45 @@ void Syncd::onSyncdStart()
     SWSS_LOG_TIMER("on syncd start");
     SWSS_LOG_NOTICE("performing syncd reinit");
 
-    HardReiniter hr(m_client, m_translator, m_vendorOtai, m_handler, m_manager);
+    if (m_journal)
+    {
+        // operations applied by previous instance which didn't reach ASIC
+        // DB before it stopped
+
+        m_journal->recover();
+    }
+
+    if (m_commandLineOptions->m_warmBoot)
+    {
+        WarmReiniter wr(m_client, m_translator, m_vendorOtai, m_handler, m_manager, m_contextConfig->m_dbState);
+
+        m_linecard = wr.warmReinit();
+
+        if (m_linecard)
+        {
+            SWSS_LOG_NOTICE("syncd warm reinit succeeded");
+
+            if (m_journal)
+            {
+                m_journal->snapshot();
+            }
+
+            return;
+        }
+
+        SWSS_LOG_WARN("warm reinit not possible, performing hard reinit");
+    }
+
+    HardReiniter hr(m_client, m_translator, m_vendorOtai, m_handler, m_manager, m_contextConfig->m_dbState, m_commandLineOptions->m_reinitConcurrency);
 
     m_linecard = hr.hardReinit();
 
+    if (m_journal)
+    {
+        // RIDs could change, so journal starts from new state
+        m_journal->snapshot();
+    }
+
     SWSS_LOG_NOTICE("syncd reinit succeeded");
 }
 
@@ -1071,6 +1203,7 @@ void Syncd::run()
                     if (linecard_state == OTAI_OPER_STATUS_INACTIVE)
                     {
                         m_manager->removeAllCounters();
+                        m_processor->clearObjectNames();
                         while (!m_selectableChannel->empty())
                         {
                             swss::KeyOpFieldsValuesTuple kco;
@@ -1079,7 +1212,7 @@ void Syncd::run()
                     }
                     else if (linecard_state == OTAI_OPER_STATUS_ACTIVE)
                     {
-                        SoftReiniter sr(m_client, m_translator, m_vendorOtai, m_manager);
+                        SoftReiniter sr(m_client, m_translator, m_vendorOtai, m_manager, m_contextConfig->m_dbState, m_commandLineOptions->m_softReinitDiffOnly);
                         sr.softReinit();
                     }
                     m_linecardState = linecard_state;
@@ -1169,14 +1302,23 @@ void Syncd::run()
     m_manager->removeAllCounters();
 
     notifyLinecardStateChange(OTAI_OPER_STATUS_INACTIVE);
-    otai_status_t status = removeLinecard();
+
+    if (m_commandLineOptions->m_warmBoot)
+    {
+        // keep hardware programmed, next syncd instance will reuse it
+        SWSS_LOG_NOTICE("warm boot enabled, linecard is not removed");
+    }
+    else
+    {
+        removeLinecard();
+    }
 
     // Stop notification thread after removing linecard
     m_processor->stopNotificationsProcessingThread();
 
     SWSS_LOG_NOTICE("calling api uninitialize");
 
-    status = m_vendorOtai->uninitialize();
+    otai_status_t status = m_vendorOtai->uninitialize();
 
     if (status != OTAI_STATUS_SUCCESS)
     {
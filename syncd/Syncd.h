@@ -16,6 +16,8 @@
 #include "RedisVidIndexGenerator.h"
 #include "NotificationProducerBase.h"
 #include "SelectableChannel.h"
+#include "AsicStateJournal.h"
+#include "ContextConfigContainer.h"
 
 #include "meta/OtaiAttributeList.h"
 
@@ -186,6 +188,11 @@ namespace syncd
 
         std::shared_ptr<CommandLineOptions> m_commandLineOptions;
 
+        /**
+         * @brief Context handled by this syncd, selects databases.
+         */
+        std::shared_ptr<otairedis::ContextConfig> m_contextConfig;
+
         LinecardNotifications m_ln;
 
         ServiceMethodTable m_smt;
@@ -214,6 +221,11 @@ namespace syncd
 
         std::shared_ptr<SelectableChannel> m_selectableChannel;
 
+        /**
+         * @brief ASIC DB operation journal, NULL when disabled.
+         */
+        std::shared_ptr<AsicStateJournal> m_journal;
+
     private:
 
         /**
@@ -242,6 +254,15 @@ namespace syncd
          */
         std::mutex m_mutex;
 
+        /**
+         * @brief Request id of currently processed event.
+         *
+         * Received in request key from otairedis and sent back in response
+         * key, so otairedis can match response to request when multiple
+         * requests are in flight. Zero when request don't contain id.
+         */
+        uint64_t m_requestId;
+
         std::shared_ptr<swss::DBConnector> m_dbAsic;
 
         std::shared_ptr<swss::NotificationConsumer> m_restartQuery;
@@ -8,7 +8,13 @@
 
 using namespace syncd;
 
-#define MUTEX() std::lock_guard<std::mutex> _lock(m_apimutex)
+/*
+ * Vendor API calls are serialized except calls from thread which is within
+ * VendorOtaiConcurrencyScope, initialize is always serialized.
+ */
+#define MUTEX()                                                             \
+    std::unique_lock<std::mutex> _lock(m_apimutex, std::defer_lock);        \
+    if (!m_bypassSerializeApi) { _lock.lock(); }
 
 #define VENDOR_CHECK_API_INITIALIZED()                                       \
     if (!m_apiInitialized) {                                                \
@@ -22,6 +28,8 @@ using namespace syncd;
             otai_serialize_object_type(object_type).c_str());               \
         return OTAI_STATUS_FAILURE; }
 
+thread_local bool VendorOtai::m_bypassSerializeApi = false;
+
 VendorOtai::VendorOtai()
 {
     SWSS_LOG_ENTER();
@@ -41,13 +49,48 @@ VendorOtai::~VendorOtai()
     }
 }
 
+bool VendorOtai::setThreadSerializeApi(
+    _In_ bool serializeApi)
+{
+    SWSS_LOG_ENTER();
+
+    bool previous = !m_bypassSerializeApi;
+
+    m_bypassSerializeApi = !serializeApi;
+
+    return previous;
+}
+
+VendorOtaiConcurrencyScope::VendorOtaiConcurrencyScope(
+    _In_ std::shared_ptr<otairedis::OtaiInterface> otai):
+    m_isVendorOtai(std::dynamic_pointer_cast<VendorOtai>(otai) != nullptr),
+    m_serializeApi(true)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_isVendorOtai)
+    {
+        m_serializeApi = VendorOtai::setThreadSerializeApi(false);
+    }
+}
+
+VendorOtaiConcurrencyScope::~VendorOtaiConcurrencyScope()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_isVendorOtai)
+    {
+        VendorOtai::setThreadSerializeApi(m_serializeApi);
+    }
+}
+
 // INITIALIZE UNINITIALIZE
 
 otai_status_t VendorOtai::initialize(
     _In_ uint64_t flags,
     _In_ const otai_service_method_table_t* service_method_table)
 {
-    MUTEX();
+    std::lock_guard<std::mutex> _lock(m_apimutex);
     SWSS_LOG_ENTER();
 
     if (m_apiInitialized)
@@ -171,7 +214,7 @@ otai_status_t VendorOtai::set(
     _In_ otai_object_id_t objectId,
     _In_ const otai_attribute_t* attr)
 {
-    std::unique_lock<std::mutex> _lock(m_apimutex);
+    MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
     VENDOR_CHECK_META_OBJECT_TYPE();
@@ -22,6 +22,17 @@ namespace syncd
 
         virtual ~VendorOtai();
 
+    public:
+
+        /**
+         * @brief Enable or disable serialization of vendor API calls made
+         * from current thread.
+         *
+         * Returns previous value.
+         */
+        static bool setThreadSerializeApi(
+            _In_ bool serializeApi);
+
     public:
 
         otai_status_t initialize(
@@ -94,10 +105,48 @@ namespace syncd
 
         bool m_apiInitialized;
 
+        /**
+         * @brief Vendor API calls from current thread are not serialized.
+         *
+         * Set only on threads which create objects concurrently on hard
+         * reinit, see VendorOtaiConcurrencyScope.
+         */
+        static thread_local bool m_bypassSerializeApi;
+
         std::mutex m_apimutex;
 
         otai_service_method_table_t m_service_method_table;
 
         otai_apis_t m_apis;
     };
+
+    /**
+     * @brief Disables serialization of vendor API calls made from current
+     * thread for lifetime of object and then restores it.
+     *
+     * Calls from other threads stay serialized. Must be used only when
+     * vendor library is thread safe. Does nothing when given interface is
+     * not vendor OTAI.
+     */
+    class VendorOtaiConcurrencyScope
+    {
+    public:
+
+        VendorOtaiConcurrencyScope(
+            _In_ std::shared_ptr<otairedis::OtaiInterface> otai);
+
+        virtual ~VendorOtaiConcurrencyScope();
+
+    private:
+
+        VendorOtaiConcurrencyScope(const VendorOtaiConcurrencyScope&) = delete;
+
+        VendorOtaiConcurrencyScope& operator=(const VendorOtaiConcurrencyScope&) = delete;
+
+    private:
+
+        bool m_isVendorOtai;
+
+        bool m_serializeApi;
+    };
 }
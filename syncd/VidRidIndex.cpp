@@ -0,0 +1,364 @@
+#include "VidRidIndex.h"
+
+#include "lib/VirtualObjectIdManager.h"
+
+#include "swss/logger.h"
+
+using namespace syncd;
+
+/*
+ * Object indexes per page, modification clones whole page, so it should stay
+ * small, 16 bytes per entry. Same as block reserved from VIDCOUNTER, so page
+ * is filled by objects of one or two blocks.
+ */
+#define VID_RID_INDEX_PAGE_SIZE (256)
+
+/*
+ * Linecard index is put above object index bits in page key.
+ */
+#define VID_RID_INDEX_LINECARD_SHIFT (48)
+
+/*
+ * Number of page groups and of shard groups, copy of index copies this many
+ * pointers of each.
+ */
+#define VID_RID_INDEX_GROUPS (64)
+
+/*
+ * Shards per group, modification clones group and one shard, so with 100k
+ * objects it clones 64 pointers and shard of about 25 entries.
+ */
+#define VID_RID_INDEX_GROUP_SHARDS (64)
+
+#define VID_RID_INDEX_RID_SHARDS (VID_RID_INDEX_GROUPS * VID_RID_INDEX_GROUP_SHARDS)
+
+VidRidIndex::VidRidIndex():
+    m_vid2rid(VID_RID_INDEX_GROUPS),
+    m_vid2ridOverflow(std::make_shared<Shard>()),
+    m_rid2vid(VID_RID_INDEX_GROUPS),
+    m_vidCount(0)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& group: m_vid2rid)
+    {
+        group = std::make_shared<PageGroup>();
+    }
+
+    for (auto& group: m_rid2vid)
+    {
+        // shards are created on first insert
+
+        group = std::make_shared<ShardGroup>(VID_RID_INDEX_GROUP_SHARDS);
+    }
+}
+
+void VidRidIndex::getPosition(
+        _In_ otai_object_id_t vid,
+        _Out_ uint64_t& key,
+        _Out_ size_t& entry)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t index = otairedis::VirtualObjectIdManager::getObjectIndex(vid);
+
+    uint64_t linecardIndex = otairedis::VirtualObjectIdManager::getLinecardIndex(vid);
+
+    key = (linecardIndex << VID_RID_INDEX_LINECARD_SHIFT) | (index / VID_RID_INDEX_PAGE_SIZE);
+
+    entry = (size_t)(index % VID_RID_INDEX_PAGE_SIZE);
+}
+
+size_t VidRidIndex::getShard(
+        _In_ otai_object_id_t rid)
+{
+    SWSS_LOG_ENTER();
+
+    // RIDs are often aligned pointers or have type in high bits, so all bits
+    // are mixed before taking shard
+
+    uint64_t hash = (uint64_t)rid * 0x9E3779B97F4A7C15ULL;
+
+    return (size_t)(hash >> 32) % VID_RID_INDEX_RID_SHARDS;
+}
+
+const VidRidIndex::Page* VidRidIndex::findPage(
+        _In_ uint64_t key) const
+{
+    SWSS_LOG_ENTER();
+
+    auto& group = *m_vid2rid[key % VID_RID_INDEX_GROUPS];
+
+    auto it = group.find(key);
+
+    return (it == group.end()) ? nullptr : it->second.get();
+}
+
+VidRidIndex::PageGroup& VidRidIndex::getWritablePageGroup(
+        _In_ uint64_t key)
+{
+    SWSS_LOG_ENTER();
+
+    auto& ptr = m_vid2rid[key % VID_RID_INDEX_GROUPS];
+
+    if (ptr.use_count() > 1)
+    {
+        ptr = std::make_shared<PageGroup>(*ptr);
+    }
+
+    return *ptr;
+}
+
+VidRidIndex::Page& VidRidIndex::getWritablePage(
+        _In_ uint64_t key)
+{
+    SWSS_LOG_ENTER();
+
+    auto& ptr = getWritablePageGroup(key)[key];
+
+    if (ptr == nullptr)
+    {
+        ptr = std::make_shared<Page>();
+
+        ptr->m_count = 0;
+        ptr->m_entries.resize(VID_RID_INDEX_PAGE_SIZE, Entry{ OTAI_NULL_OBJECT_ID, OTAI_NULL_OBJECT_ID });
+    }
+    else if (ptr.use_count() > 1)
+    {
+        // shared with other copy, which can be published to readers
+
+        ptr = std::make_shared<Page>(*ptr);
+    }
+
+    return *ptr;
+}
+
+VidRidIndex::Shard& VidRidIndex::getWritableShard(
+        _In_ size_t shard)
+{
+    SWSS_LOG_ENTER();
+
+    auto& group = m_rid2vid[shard / VID_RID_INDEX_GROUP_SHARDS];
+
+    if (group.use_count() > 1)
+    {
+        group = std::make_shared<ShardGroup>(*group);
+    }
+
+    auto& ptr = (*group)[shard % VID_RID_INDEX_GROUP_SHARDS];
+
+    if (ptr == nullptr)
+    {
+        ptr = std::make_shared<Shard>();
+    }
+    else if (ptr.use_count() > 1)
+    {
+        ptr = std::make_shared<Shard>(*ptr);
+    }
+
+    return *ptr;
+}
+
+VidRidIndex::Shard& VidRidIndex::getWritableOverflow()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_vid2ridOverflow.use_count() > 1)
+    {
+        m_vid2ridOverflow = std::make_shared<Shard>(*m_vid2ridOverflow);
+    }
+
+    return *m_vid2ridOverflow;
+}
+
+bool VidRidIndex::tryGetRid(
+        _In_ otai_object_id_t vid,
+        _Out_ otai_object_id_t& rid) const
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t key;
+    size_t entry;
+
+    getPosition(vid, key, entry);
+
+    auto page = findPage(key);
+
+    if (page && page->m_entries[entry].m_vid == vid)
+    {
+        rid = page->m_entries[entry].m_rid;
+
+        return true;
+    }
+
+    auto it = m_vid2ridOverflow->find(vid);
+
+    if (it == m_vid2ridOverflow->end())
+    {
+        rid = OTAI_NULL_OBJECT_ID;
+
+        return false;
+    }
+
+    rid = it->second;
+
+    return true;
+}
+
+bool VidRidIndex::tryGetVid(
+        _In_ otai_object_id_t rid,
+        _Out_ otai_object_id_t& vid) const
+{
+    SWSS_LOG_ENTER();
+
+    size_t idx = getShard(rid);
+
+    auto& shard = (*m_rid2vid[idx / VID_RID_INDEX_GROUP_SHARDS])[idx % VID_RID_INDEX_GROUP_SHARDS];
+
+    if (shard)
+    {
+        auto it = shard->find(rid);
+
+        if (it != shard->end())
+        {
+            vid = it->second;
+
+            return true;
+        }
+    }
+
+    vid = OTAI_NULL_OBJECT_ID;
+
+    return false;
+}
+
+void VidRidIndex::insert(
+        _In_ otai_object_id_t vid,
+        _In_ otai_object_id_t rid)
+{
+    SWSS_LOG_ENTER();
+
+    insertVid(vid, rid);
+    insertRid(rid, vid);
+}
+
+void VidRidIndex::insertVid(
+        _In_ otai_object_id_t vid,
+        _In_ otai_object_id_t rid)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t key;
+    size_t entry;
+
+    getPosition(vid, key, entry);
+
+    if (m_vid2ridOverflow->find(vid) == m_vid2ridOverflow->end())
+    {
+        auto page = findPage(key);
+
+        otai_object_id_t current = page ? page->m_entries[entry].m_vid : OTAI_NULL_OBJECT_ID;
+
+        if (current == vid || current == OTAI_NULL_OBJECT_ID)
+        {
+            auto& writable = getWritablePage(key);
+
+            if (current == OTAI_NULL_OBJECT_ID)
+            {
+                writable.m_count++;
+
+                m_vidCount++;
+            }
+
+            writable.m_entries[entry] = Entry{ vid, rid };
+
+            return;
+        }
+
+        // entry is taken by other VID with same linecard and object index
+
+        m_vidCount++;
+    }
+
+    getWritableOverflow()[vid] = rid;
+}
+
+void VidRidIndex::insertRid(
+        _In_ otai_object_id_t rid,
+        _In_ otai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
+
+    getWritableShard(getShard(rid))[rid] = vid;
+}
+
+void VidRidIndex::eraseVid(
+        _In_ otai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t key;
+    size_t entry;
+
+    getPosition(vid, key, entry);
+
+    auto page = findPage(key);
+
+    if (page && page->m_entries[entry].m_vid == vid)
+    {
+        if (page->m_count == 1)
+        {
+            // last entry, page is dropped without clone
+
+            getWritablePageGroup(key).erase(key);
+        }
+        else
+        {
+            auto& writable = getWritablePage(key);
+
+            writable.m_entries[entry] = Entry{ OTAI_NULL_OBJECT_ID, OTAI_NULL_OBJECT_ID };
+            writable.m_count--;
+        }
+
+        m_vidCount--;
+
+        return;
+    }
+
+    if (m_vid2ridOverflow->find(vid) != m_vid2ridOverflow->end())
+    {
+        getWritableOverflow().erase(vid);
+
+        m_vidCount--;
+    }
+}
+
+void VidRidIndex::erase(
+        _In_ otai_object_id_t vid,
+        _In_ otai_object_id_t rid)
+{
+    SWSS_LOG_ENTER();
+
+    eraseVid(vid);
+
+    otai_object_id_t v;
+
+    if (tryGetVid(rid, v))
+    {
+        getWritableShard(getShard(rid)).erase(rid);
+    }
+}
+
+void VidRidIndex::clear()
+{
+    SWSS_LOG_ENTER();
+
+    *this = VidRidIndex();
+}
+
+size_t VidRidIndex::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_vidCount;
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+extern "C" {
+#include "otaimetadata.h"
+}
+
+#include "swss/sal.h"
+
+#include <vector>
+#include <unordered_map>
+#include <memory>
+
+namespace syncd
+{
+    /**
+     * @brief Bidirectional VID/RID index.
+     *
+     * VIDs are allocated by syncd/otairedis with linecard index, object type
+     * and object index encoded. Object indexes of all types are reserved in
+     * blocks from single counter, so indexes of one object type are sparse,
+     * while whole allocated range is dense. VID to RID direction is kept in
+     * pages per linecard and range of object indexes, each entry holds VID
+     * and RID, and VIDs which collide with other VID in page (linecard VIDs
+     * use linecard index as object index) are kept in hash. Only pages with
+     * entries are kept, so counter growing over restarts costs nothing.
+     * RIDs are vendor defined so RID to VID direction is kept in hash
+     * shards.
+     *
+     * Pages and shards are shared between copies and are reached through
+     * fixed number of groups, which are shared too. Copy of index copies
+     * only group pointers and modification of a copy clones only touched
+     * group and page or shard, so cost of both is bounded independently of
+     * number of objects. This allows to publish immutable snapshots to
+     * readers, while writer modifies its own copy. Modification of single
+     * instance is not thread safe.
+     */
+    class VidRidIndex
+    {
+        public:
+
+            VidRidIndex();
+
+            virtual ~VidRidIndex() = default;
+
+        public:
+
+            bool tryGetRid(
+                    _In_ otai_object_id_t vid,
+                    _Out_ otai_object_id_t& rid) const;
+
+            bool tryGetVid(
+                    _In_ otai_object_id_t rid,
+                    _Out_ otai_object_id_t& vid) const;
+
+            void insert(
+                    _In_ otai_object_id_t vid,
+                    _In_ otai_object_id_t rid);
+
+            /**
+             * @brief Insert only VID to RID direction.
+             *
+             * Used when RID was obtained from redis by VID, but RID to VID
+             * entry was not confirmed.
+             */
+            void insertVid(
+                    _In_ otai_object_id_t vid,
+                    _In_ otai_object_id_t rid);
+
+            /**
+             * @brief Insert only RID to VID direction.
+             */
+            void insertRid(
+                    _In_ otai_object_id_t rid,
+                    _In_ otai_object_id_t vid);
+
+            void erase(
+                    _In_ otai_object_id_t vid,
+                    _In_ otai_object_id_t rid);
+
+            void clear();
+
+            size_t size() const;
+
+        private:
+
+            typedef struct _Entry
+            {
+                otai_object_id_t m_vid;
+
+                otai_object_id_t m_rid;
+
+            } Entry;
+
+            typedef struct _Page
+            {
+                size_t m_count;
+
+                std::vector<Entry> m_entries;
+
+            } Page;
+
+            typedef std::unordered_map<otai_object_id_t, otai_object_id_t> Shard;
+
+            typedef std::unordered_map<uint64_t, std::shared_ptr<Page>> PageGroup;
+
+            typedef std::vector<std::shared_ptr<Shard>> ShardGroup;
+
+            /**
+             * @brief Get page key and entry in page for VID.
+             */
+            static void getPosition(
+                    _In_ otai_object_id_t vid,
+                    _Out_ uint64_t& key,
+                    _Out_ size_t& entry);
+
+            static size_t getShard(
+                    _In_ otai_object_id_t rid);
+
+            const Page* findPage(
+                    _In_ uint64_t key) const;
+
+            /**
+             * @brief Get page group for modification.
+             *
+             * Group is cloned if it's shared with other copy of index.
+             */
+            PageGroup& getWritablePageGroup(
+                    _In_ uint64_t key);
+
+            /**
+             * @brief Get page for modification.
+             *
+             * Page and its group are cloned if they are shared with other
+             * copy of index.
+             */
+            Page& getWritablePage(
+                    _In_ uint64_t key);
+
+            Shard& getWritableShard(
+                    _In_ size_t shard);
+
+            Shard& getWritableOverflow();
+
+            void eraseVid(
+                    _In_ otai_object_id_t vid);
+
+        private:
+
+            /**
+             * @brief VID to RID page groups.
+             *
+             * Pages are keyed by linecard index and page of object index,
+             * entry with OTAI_NULL_OBJECT_ID VID is empty.
+             */
+            std::vector<std::shared_ptr<PageGroup>> m_vid2rid;
+
+            std::shared_ptr<Shard> m_vid2ridOverflow;
+
+            /**
+             * @brief RID to VID shard groups.
+             */
+            std::vector<std::shared_ptr<ShardGroup>> m_rid2vid;
+
+            size_t m_vidCount;
+    };
+}
@@ -19,7 +19,33 @@ VirtualOidTranslator::VirtualOidTranslator(
 {
     SWSS_LOG_ENTER();
 
-    // empty
+    m_index = std::make_shared<VidRidIndex>();
+}
+
+std::shared_ptr<const VidRidIndex> VirtualOidTranslator::getIndex() const
+{
+    SWSS_LOG_ENTER();
+
+    return std::atomic_load(&m_index);
+}
+
+std::shared_ptr<VidRidIndex> VirtualOidTranslator::copyIndex() const
+{
+    SWSS_LOG_ENTER();
+
+    // only pages and shards pointers are copied
+
+    return std::make_shared<VidRidIndex>(*m_index);
+}
+
+void VirtualOidTranslator::publishIndex(
+        _In_ std::shared_ptr<VidRidIndex> index)
+{
+    SWSS_LOG_ENTER();
+
+    std::shared_ptr<const VidRidIndex> published = index;
+
+    std::atomic_store(&m_index, published);
 }
 
 bool VirtualOidTranslator::tryTranslateRidToVid(
@@ -28,8 +54,6 @@ bool VirtualOidTranslator::tryTranslateRidToVid(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-
     if (rid == OTAI_NULL_OBJECT_ID)
     {
         SWSS_LOG_DEBUG("translated RID null to VID null");
@@ -38,14 +62,13 @@ bool VirtualOidTranslator::tryTranslateRidToVid(
         return true;
     }
 
-    auto it = m_rid2vid.find(vid);
-
-    if (it != m_rid2vid.end())
+    if (getIndex()->tryGetVid(rid, vid))
     {
-        vid = it->second;
         return true;
     }
 
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     vid = m_client->getVidForRid(rid);
 
     if (vid == OTAI_NULL_OBJECT_ID)
@@ -54,6 +77,12 @@ bool VirtualOidTranslator::tryTranslateRidToVid(
         return false;
     }
 
+    auto index = copyIndex();
+
+    index->insertRid(rid, vid);
+
+    publishIndex(index);
+
     return true;
 }
 
@@ -64,87 +93,183 @@ otai_object_id_t VirtualOidTranslator::translateRidToVid(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-
     /*
      * NOTE: linecard_vid here is Virtual ID of linecard for which we need
      * create VID for given RID.
      */
 
-    if (rid == OTAI_NULL_OBJECT_ID)
+    otai_object_id_t id = rid;
+
+    translateRidsToVids({ &id }, linecardVid, translateRemoved);
+
+    return id;
+}
+
+void VirtualOidTranslator::translateRidsToVids(
+        _In_ const std::vector<otai_object_id_t*>& ids,
+        _In_ otai_object_id_t linecardVid,
+        _In_ bool translateRemoved)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<otai_object_id_t*> missing;
+
+    auto snapshot = getIndex();
+
+    for (auto id: ids)
     {
-        SWSS_LOG_DEBUG("translated RID null to VID null");
+        otai_object_id_t vid;
 
-        return OTAI_NULL_OBJECT_ID;
-    }
+        if (*id == OTAI_NULL_OBJECT_ID)
+        {
+            // null RID translates to null VID
+
+            continue;
+        }
 
-    auto it = m_rid2vid.find(rid);
+        if (snapshot->tryGetVid(*id, vid))
+        {
+            *id = vid;
+            continue;
+        }
+
+        missing.push_back(id);
+    }
 
-    if (it != m_rid2vid.end())
+    if (missing.empty())
     {
-        return it->second;
+        return;
     }
 
-    std::string strRid = otai_serialize_object_id(rid);
+    std::unique_lock<std::mutex> lock(m_mutex);
 
-    auto vid = m_client->getVidForRid(rid);
+    // all RIDs are added to single copy, which is published once
 
-    if (vid != OTAI_NULL_OBJECT_ID)
+    auto index = copyIndex();
+
+    // other writer could add some RIDs while we were waiting, rest is looked
+    // up in redis at once
+
+    std::vector<otai_object_id_t*> lookup;
+    std::vector<otai_object_id_t> rids;
+
+    for (auto id: missing)
     {
-        // object exists
+        otai_object_id_t vid;
 
-        SWSS_LOG_DEBUG("translated RID %s to VID %s",
-                otai_serialize_object_id(rid).c_str(),
-                otai_serialize_object_id(vid).c_str());
+        if (index->tryGetVid(*id, vid))
+        {
+            *id = vid;
+            continue;
+        }
 
-        return vid;
+        lookup.push_back(id);
+        rids.push_back(*id);
     }
 
-    if (translateRemoved)
+    auto vids = m_client->getVidsForRids(rids);
+
+    std::vector<std::pair<otai_object_id_t, otai_object_id_t>> created;
+
+    bool modified = false;
+
+    for (size_t idx = 0; idx < lookup.size(); idx++)
     {
-        auto itr = m_removedRid2vid.find(rid);
+        otai_object_id_t rid = rids[idx];
+        otai_object_id_t vid = vids[idx];
+
+        if (vid == OTAI_NULL_OBJECT_ID && index->tryGetVid(rid, vid))
+        {
+            // same RID was spotted earlier in this batch
 
-        if (itr !=  m_removedRid2vid.end())
+            *lookup[idx] = vid;
+            continue;
+        }
+
+        if (vid != OTAI_NULL_OBJECT_ID)
         {
-            SWSS_LOG_WARN("translating removed RID %s, to VID %s",
+            // object exists
+
+            SWSS_LOG_DEBUG("translated RID %s to VID %s",
                     otai_serialize_object_id(rid).c_str(),
-                    otai_serialize_object_id(itr->second).c_str());
+                    otai_serialize_object_id(vid).c_str());
+
+            index->insertRid(rid, vid);
+
+            modified = true;
 
-            return itr->second;
+            *lookup[idx] = vid;
+            continue;
         }
-    }
 
-    SWSS_LOG_DEBUG("spotted new RID %s", otai_serialize_object_id(rid).c_str());
+        if (translateRemoved)
+        {
+            auto itr = m_removedRid2vid.find(rid);
 
-    otai_object_type_t object_type = m_vendorOtai->objectTypeQuery(rid); // TODO move to std::function or wrapper class
+            if (itr !=  m_removedRid2vid.end())
+            {
+                SWSS_LOG_WARN("translating removed RID %s, to VID %s",
+                        otai_serialize_object_id(rid).c_str(),
+                        otai_serialize_object_id(itr->second).c_str());
 
-    if (object_type == OTAI_OBJECT_TYPE_NULL)
-    {
-        SWSS_LOG_THROW("vendorOtai->objectTypeQuery returned NULL type for RID 0x%" PRIx64, rid);
+                *lookup[idx] = itr->second;
+                continue;
+            }
+        }
+
+        SWSS_LOG_DEBUG("spotted new RID %s", otai_serialize_object_id(rid).c_str());
+
+        otai_object_type_t object_type = m_vendorOtai->objectTypeQuery(rid); // TODO move to std::function or wrapper class
+
+        if (object_type == OTAI_OBJECT_TYPE_NULL)
+        {
+            SWSS_LOG_THROW("vendorOtai->objectTypeQuery returned NULL type for RID 0x%" PRIx64, rid);
+        }
+
+        if (object_type == OTAI_OBJECT_TYPE_LINECARD)
+        {
+            /*
+             * Linecard ID should be already inside local db or redis db when we
+             * created linecard, so we should never get here.
+             */
+
+            SWSS_LOG_THROW("RID 0x%" PRIx64 " is linecard object, but not in local or redis db, bug!", rid);
+        }
+
+        vid = m_virtualObjectIdManager->allocateNewObjectId(object_type, linecardVid); // TODO to std::function or separate object
+
+        SWSS_LOG_DEBUG("translated RID %s to VID %s",
+                otai_serialize_object_id(rid).c_str(),
+                otai_serialize_object_id(vid).c_str());
+
+        index->insert(vid, rid);
+
+        created.emplace_back(vid, rid);
+
+        modified = true;
+
+        *lookup[idx] = vid;
     }
 
-    if (object_type == OTAI_OBJECT_TYPE_LINECARD)
+    if (!modified)
     {
-        /*
-         * Linecard ID should be already inside local db or redis db when we
-         * created linecard, so we should never get here.
-         */
-
-        SWSS_LOG_THROW("RID 0x%" PRIx64 " is linecard object, but not in local or redis db, bug!", rid);
+        return;
     }
 
-    vid = m_virtualObjectIdManager->allocateNewObjectId(object_type, linecardVid); // TODO to std::function or separate object
+    publishIndex(index);
+
+    if (created.empty())
+    {
+        return;
+    }
 
-    SWSS_LOG_DEBUG("translated RID %s to VID %s",
-            otai_serialize_object_id(rid).c_str(),
-            otai_serialize_object_id(vid).c_str());
+    // redis is updated behind the fast path, new pairs in single transaction
 
-    m_client->insertVidAndRid(vid, rid);
+    std::lock_guard<std::mutex> writeLock(m_writeMutex);
 
-    m_rid2vid[rid] = vid;
-    m_vid2rid[vid] = rid;
+    lock.unlock();
 
-    return vid;
+    m_client->insertVidsAndRids(created);
 }
 
 bool VirtualOidTranslator::checkRidExists(
@@ -153,15 +278,17 @@ bool VirtualOidTranslator::checkRidExists(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-
     if (rid == OTAI_NULL_OBJECT_ID)
         return true;
 
-    if (m_rid2vid.find(rid) != m_rid2vid.end())
+    otai_object_id_t vid;
+
+    if (getIndex()->tryGetVid(rid, vid))
         return true;
 
-    auto vid = m_client->getVidForRid(rid);
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    vid = m_client->getVidForRid(rid);
 
     if (vid != OTAI_NULL_OBJECT_ID)
         return true;
@@ -182,10 +309,14 @@ void VirtualOidTranslator::translateRidToVid(
 {
     SWSS_LOG_ENTER();
 
+    std::vector<otai_object_id_t*> ids;
+
     for (uint32_t i = 0; i < element.count; i++)
     {
-        element.list[i] = translateRidToVid(element.list[i], linecardVid, translateRemoved);
+        ids.push_back(&element.list[i]);
     }
+
+    translateRidsToVids(ids, linecardVid, translateRemoved);
 }
 
 void VirtualOidTranslator::translateRidToVid(
@@ -202,8 +333,13 @@ void VirtualOidTranslator::translateRidToVid(
      * and put in db, if entry exists in db, use it.
      *
      * NOTE: linecard_id is VID of linecard on which those RIDs are provided.
+     *
+     * RIDs of all attributes are translated at once, so new VIDs are
+     * written to redis in single transaction.
      */
 
+    std::vector<otai_object_id_t*> ids;
+
     for (uint32_t i = 0; i < attr_count; i++)
     {
         otai_attribute_t &attr = attrList[i];
@@ -224,11 +360,16 @@ void VirtualOidTranslator::translateRidToVid(
         switch (meta->attrvaluetype)
         {
             case OTAI_ATTR_VALUE_TYPE_OBJECT_ID:
-                attr.value.oid = translateRidToVid(attr.value.oid, linecardVid, translateRemoved);
+                ids.push_back(&attr.value.oid);
                 break;
 
             case OTAI_ATTR_VALUE_TYPE_OBJECT_LIST:
-                translateRidToVid(attr.value.objlist, linecardVid, translateRemoved);
+
+                for (uint32_t j = 0; j < attr.value.objlist.count; j++)
+                {
+                    ids.push_back(&attr.value.objlist.list[j]);
+                }
+
                 break;
 
             default:
@@ -246,6 +387,8 @@ void VirtualOidTranslator::translateRidToVid(
                 break;
         }
     }
+
+    translateRidsToVids(ids, linecardVid, translateRemoved);
 }
 
 otai_object_id_t VirtualOidTranslator::translateVidToRid(
@@ -253,8 +396,6 @@ otai_object_id_t VirtualOidTranslator::translateVidToRid(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-
     if (vid == OTAI_NULL_OBJECT_ID)
     {
         SWSS_LOG_DEBUG("translated VID null to RID null");
@@ -262,14 +403,16 @@ otai_object_id_t VirtualOidTranslator::translateVidToRid(
         return OTAI_NULL_OBJECT_ID;
     }
 
-    auto it = m_vid2rid.find(vid);
+    otai_object_id_t rid;
 
-    if (it != m_vid2rid.end())
+    if (getIndex()->tryGetRid(vid, rid))
     {
-        return it->second;
+        return rid;
     }
 
-    auto rid = m_client->getRidForVid(vid);
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    rid = m_client->getRidForVid(vid);
 
     if (rid == OTAI_NULL_OBJECT_ID)
     {
@@ -297,7 +440,11 @@ otai_object_id_t VirtualOidTranslator::translateVidToRid(
      * faster to retrieve it late on.
      */
 
-    m_vid2rid[vid] = rid;
+    auto index = copyIndex();
+
+    index->insertVid(vid, rid);
+
+    publishIndex(index);
 
     SWSS_LOG_DEBUG("translated VID %s to RID %s",
             otai_serialize_object_id(vid).c_str(),
@@ -422,12 +569,19 @@ void VirtualOidTranslator::insertRidAndVid(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    auto index = copyIndex();
+
+    index->insert(vid, rid);
+
+    publishIndex(index);
+
+    // redis is updated behind the fast path
 
-    // to support multiple linecards vid/rid map must be per linecard 
+    std::lock_guard<std::mutex> writeLock(m_writeMutex);
 
-    m_rid2vid[rid] = vid;
-    m_vid2rid[vid] = rid;
+    lock.unlock();
 
     m_client->insertVidAndRid(vid, rid);
 }
@@ -438,16 +592,25 @@ void VirtualOidTranslator::eraseRidAndVid(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-
-    m_client->removeVidAndRid(vid, rid);
+    std::unique_lock<std::mutex> lock(m_mutex);
 
     // remove from local vid2rid and rid2vid map
 
-    m_rid2vid.erase(rid);
-    m_vid2rid.erase(vid);
+    auto index = copyIndex();
+
+    index->erase(vid, rid);
+
+    publishIndex(index);
 
     m_removedRid2vid[rid] = vid;
+
+    // redis is updated behind the fast path
+
+    std::lock_guard<std::mutex> writeLock(m_writeMutex);
+
+    lock.unlock();
+
+    m_client->removeVidAndRid(vid, rid);
 }
 
 void VirtualOidTranslator::clearLocalCache()
@@ -456,8 +619,36 @@ void VirtualOidTranslator::clearLocalCache()
 
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    m_rid2vid.clear();
-    m_vid2rid.clear();
+    publishIndex(std::make_shared<VidRidIndex>());
 
     m_removedRid2vid.clear();
 }
+
+void VirtualOidTranslator::preload(
+        _In_ const std::unordered_map<otai_object_id_t, otai_object_id_t>& vid2rid,
+        _In_ const std::unordered_map<otai_object_id_t, otai_object_id_t>& rid2vid)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // new index is not shared, so it's filled in place
+
+    auto index = std::make_shared<VidRidIndex>();
+
+    for (auto& v2r: vid2rid)
+    {
+        index->insertVid(v2r.first, v2r.second);
+    }
+
+    for (auto& r2v: rid2vid)
+    {
+        index->insertRid(r2v.first, r2v.second);
+    }
+
+    publishIndex(index);
+
+    m_removedRid2vid.clear();
+
+    SWSS_LOG_NOTICE("preloaded %zu VIDs and %zu RIDs", vid2rid.size(), rid2vid.size());
+}
@@ -6,6 +6,7 @@ extern "C"{
 
 #include "VirtualObjectIdManager.h"
 #include "RedisClient.h"
+#include "VidRidIndex.h"
 
 #include "meta/OtaiInterface.h"
 
@@ -113,18 +114,81 @@ namespace syncd
 
             void clearLocalCache();
 
+            /**
+             * @brief Preload local cache.
+             *
+             * Replaces local cache with maps read from VIDTORID and RIDTOVID
+             * hashes, so translations will not need to reach redis.
+             */
+            void preload(
+                    _In_ const std::unordered_map<otai_object_id_t, otai_object_id_t>& vid2rid,
+                    _In_ const std::unordered_map<otai_object_id_t, otai_object_id_t>& rid2vid);
+
+        private:
+
+            /**
+             * @brief Translate RIDs in place.
+             *
+             * RIDs missing in index are looked up in redis at once, and new
+             * VIDs are published in single index copy and written to redis
+             * in single transaction.
+             */
+            void translateRidsToVids(
+                    _In_ const std::vector<otai_object_id_t*>& ids,
+                    _In_ otai_object_id_t linecardVid,
+                    _In_ bool translateRemoved);
+
+            /**
+             * @brief Get current index snapshot.
+             *
+             * Readers never take mutex, they work on snapshot which is not
+             * modified after publish.
+             */
+            std::shared_ptr<const VidRidIndex> getIndex() const;
+
+            /**
+             * @brief Copy current index for modification.
+             *
+             * Must be called under mutex.
+             */
+            std::shared_ptr<VidRidIndex> copyIndex() const;
+
+            /**
+             * @brief Publish modified index to readers.
+             *
+             * Must be called under mutex.
+             */
+            void publishIndex(
+                    _In_ std::shared_ptr<VidRidIndex> index);
+
         private:
 
             std::shared_ptr<otairedis::VirtualObjectIdManager> m_virtualObjectIdManager;
 
             std::shared_ptr<otairedis::OtaiInterface> m_vendorOtai;
 
+            /**
+             * @brief Writers mutex.
+             *
+             * Serializes index modifications and redis fallback lookups,
+             * readers which hit the index don't take it.
+             */
             std::mutex m_mutex;
 
-            // those hashes keep mapping from all linecards
+            /**
+             * @brief Serializes redis write back.
+             *
+             * Taken before local mutex is released, so redis is updated in
+             * the same order as local cache, but readers don't wait for
+             * redis.
+             */
+            std::mutex m_writeMutex;
+
+            // this index keeps mapping from all linecards, it's only accessed
+            // by atomic load and store
+
+            std::shared_ptr<const VidRidIndex> m_index;
 
-            std::unordered_map<otai_object_id_t, otai_object_id_t> m_rid2vid;
-            std::unordered_map<otai_object_id_t, otai_object_id_t> m_vid2rid;
             std::unordered_map<otai_object_id_t, otai_object_id_t> m_removedRid2vid;
 
             std::shared_ptr<RedisClient> m_client;
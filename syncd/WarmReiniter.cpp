@@ -0,0 +1,422 @@
+#include "WarmReiniter.h"
+#include "FlexCounterReiniter.h"
+#include "RedisClient.h"
+
+#include "swss/logger.h"
+
+#include "meta/otai_serialize.h"
+
+#include <map>
+#include <chrono>
+#include <inttypes.h>
+
+using namespace syncd;
+using namespace otaimeta;
+
+WarmReiniter::WarmReiniter(
+        _In_ std::shared_ptr<RedisClient> client,
+        _In_ std::shared_ptr<VirtualOidTranslator> translator,
+        _In_ std::shared_ptr<otairedis::OtaiInterface> otai,
+        _In_ std::shared_ptr<NotificationHandler> handler,
+        _In_ std::shared_ptr<FlexCounterManager> manager,
+        _In_ const std::string& dbState):
+    m_linecardVid(OTAI_NULL_OBJECT_ID),
+    m_linecardRid(OTAI_NULL_OBJECT_ID),
+    m_sampledObjects(0),
+    m_sampledAttributes(0),
+    m_mismatches(0),
+    m_vendorOtai(otai),
+    m_translator(translator),
+    m_client(client),
+    m_handler(handler),
+    m_manager(manager),
+    m_dbState(dbState)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+WarmReiniter::~WarmReiniter()
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void WarmReiniter::readAsicState()
+{
+    SWSS_LOG_ENTER();
+    SWSS_LOG_TIMER("read asic state");
+
+    m_vidToRidMap = m_client->getVidToRidMap();
+    m_ridToVidMap = m_client->getRidToVidMap();
+    m_asicKeys = m_client->getAsicStateKeys();
+}
+
+otai_object_id_t WarmReiniter::getObjectIdFromAsicKey(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    auto start = key.find_first_of(":") + 1;
+    auto end = key.find(":", start);
+
+    otai_object_id_t oid;
+    otai_deserialize_object_id(key.substr(end + 1), oid);
+
+    return oid;
+}
+
+std::string WarmReiniter::getLinecardKey() const
+{
+    SWSS_LOG_ENTER();
+
+    std::string linecardKey;
+
+    for (auto& key: m_asicKeys)
+    {
+        if (AsicStateSnapshot::getObjectTypeFromAsicKey(key) != OTAI_OBJECT_TYPE_LINECARD)
+        {
+            continue;
+        }
+
+        if (!linecardKey.empty())
+        {
+            SWSS_LOG_WARN("multiple linecards in ASIC DB, warm reinit not supported");
+
+            return "";
+        }
+
+        linecardKey = key;
+    }
+
+    return linecardKey;
+}
+
+bool WarmReiniter::bindLinecard(
+        _In_ const std::string& linecardKey)
+{
+    SWSS_LOG_ENTER();
+
+    m_linecardVid = getObjectIdFromAsicKey(linecardKey);
+
+    auto it = m_vidToRidMap.find(m_linecardVid);
+
+    if (it == m_vidToRidMap.end())
+    {
+        SWSS_LOG_WARN("linecard VID %s is missing in VID to RID map",
+                otai_serialize_object_id(m_linecardVid).c_str());
+
+        return false;
+    }
+
+    auto list = m_attributesLists.at(linecardKey);
+
+    otai_attribute_t* attrList = list->get_attr_list();
+
+    uint32_t attrCount = list->get_attr_count();
+
+    m_handler->updateNotificationsPointers(OTAI_OBJECT_TYPE_LINECARD, attrCount, attrList);
+
+    // only attributes required on create are passed, all other attributes
+    // are expected to be already programmed in hardware
+
+    std::vector<otai_attribute_t> attrs;
+
+    for (uint32_t idx = 0; idx < attrCount; ++idx)
+    {
+        auto meta = otai_metadata_get_attr_metadata(OTAI_OBJECT_TYPE_LINECARD, attrList[idx].id);
+
+        if (OTAI_HAS_FLAG_MANDATORY_ON_CREATE(meta->flags) || OTAI_HAS_FLAG_CREATE_ONLY(meta->flags))
+        {
+            attrs.push_back(attrList[idx]);
+        }
+    }
+
+    otai_status_t status = m_vendorOtai->create(OTAI_OBJECT_TYPE_LINECARD, &m_linecardRid, 0, (uint32_t)attrs.size(), attrs.data());
+
+    if (status != OTAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_THROW("failed to create linecard RID: %s",
+                otai_serialize_status(status).c_str());
+    }
+
+    if (m_linecardRid != it->second)
+    {
+        SWSS_LOG_WARN("linecard RID changed from %s to %s",
+                otai_serialize_object_id(it->second).c_str(),
+                otai_serialize_object_id(m_linecardRid).c_str());
+
+        return false;
+    }
+
+    SWSS_LOG_NOTICE("linecard VID %s bound to RID %s",
+            otai_serialize_object_id(m_linecardVid).c_str(),
+            otai_serialize_object_id(m_linecardRid).c_str());
+
+    return true;
+}
+
+bool WarmReiniter::checkObject(
+        _In_ const std::string& asicKey)
+{
+    SWSS_LOG_ENTER();
+
+    auto objectType = AsicStateSnapshot::getObjectTypeFromAsicKey(asicKey);
+
+    auto vid = getObjectIdFromAsicKey(asicKey);
+
+    auto it = m_vidToRidMap.find(vid);
+
+    if (it == m_vidToRidMap.end())
+    {
+        SWSS_LOG_WARN("VID %s is missing in VID to RID map",
+                otai_serialize_object_id(vid).c_str());
+
+        return false;
+    }
+
+    auto list = m_attributesLists.at(asicKey);
+
+    otai_attribute_t* attrList = list->get_attr_list();
+
+    uint32_t attrCount = list->get_attr_count();
+
+    uint32_t compared = 0;
+    uint32_t readable = 0;
+
+    for (uint32_t idx = 0; idx < attrCount; ++idx)
+    {
+        auto meta = otai_metadata_get_attr_metadata(objectType, attrList[idx].id);
+
+        switch (meta->attrvaluetype)
+        {
+            case OTAI_ATTR_VALUE_TYPE_OBJECT_ID:
+            case OTAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+            case OTAI_ATTR_VALUE_TYPE_POINTER:
+                // ASIC DB holds VIDs and syncd pointers
+                continue;
+
+            default:
+                break;
+        }
+
+        std::string expected = otai_serialize_attr_value(*meta, attrList[idx]);
+
+        // list is deserialized from ASIC DB value, so list buffers have the
+        // size of expected value
+
+        OtaiAttributeList current(objectType,
+                std::vector<swss::FieldValueTuple>{ { otai_serialize_attr_id(*meta), expected } }, false);
+
+        otai_attribute_t* attr = current.get_attr_list();
+
+        compared++;
+
+        if (m_vendorOtai->get(objectType, it->second, 1, attr) != OTAI_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        readable++;
+        m_sampledAttributes++;
+
+        std::string actual = otai_serialize_attr_value(*meta, *attr);
+
+        if (actual != expected)
+        {
+            SWSS_LOG_WARN("%s VID %s attribute %s is %s in hardware, expected %s",
+                    otai_serialize_object_type(objectType).c_str(),
+                    otai_serialize_object_id(vid).c_str(),
+                    meta->attridname,
+                    actual.c_str(),
+                    expected.c_str());
+
+            m_mismatches++;
+
+            return false;
+        }
+    }
+
+    if (compared && !readable)
+    {
+        // none of the attributes could be read, vendor doesn't know this RID
+
+        SWSS_LOG_WARN("%s RID %s is not known by vendor",
+                otai_serialize_object_type(objectType).c_str(),
+                otai_serialize_object_id(it->second).c_str());
+
+        m_mismatches++;
+
+        return false;
+    }
+
+    m_sampledObjects++;
+
+    return true;
+}
+
+bool WarmReiniter::checkSamples()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("warm reinit sample check");
+
+    // ordered by VID, so samples are the same on every restart
+
+    std::map<otai_object_type_t, std::map<otai_object_id_t, std::string>> keysByType;
+
+    for (auto& key: m_asicKeys)
+    {
+        keysByType[AsicStateSnapshot::getObjectTypeFromAsicKey(key)][getObjectIdFromAsicKey(key)] = key;
+    }
+
+    for (auto& kvp: keysByType)
+    {
+        auto& keys = kvp.second;
+
+        size_t step = keys.size() / WARM_REINIT_SAMPLES_PER_TYPE;
+
+        if (step == 0)
+        {
+            step = 1;
+        }
+
+        size_t idx = 0;
+        size_t taken = 0;
+
+        for (auto& key: keys)
+        {
+            if (taken == WARM_REINIT_SAMPLES_PER_TYPE)
+            {
+                break;
+            }
+
+            if (idx++ % step)
+            {
+                continue;
+            }
+
+            taken++;
+
+            if (!checkObject(key.second))
+            {
+                return false;
+            }
+        }
+    }
+
+    SWSS_LOG_NOTICE("warm reinit checked %u attributes on %u objects",
+            m_sampledAttributes,
+            m_sampledObjects);
+
+    return true;
+}
+
+std::shared_ptr<syncd::OtaiLinecard> WarmReiniter::warmReinit()
+{
+    SWSS_LOG_ENTER();
+
+    auto statistics = std::make_shared<ReinitStatistics>("WARM", m_dbState);
+
+    try
+    {
+        auto linecard = warmReinit(statistics);
+
+        statistics->setFields({
+                { "sampled-objects", std::to_string(m_sampledObjects) },
+                { "sampled-attributes", std::to_string(m_sampledAttributes) },
+                { "mismatches", std::to_string(m_mismatches) } });
+
+        statistics->finish(linecard != nullptr);
+
+        return linecard;
+    }
+    catch (const std::exception&)
+    {
+        statistics->finish(false);
+
+        throw;
+    }
+}
+
+std::shared_ptr<syncd::OtaiLinecard> WarmReiniter::warmReinit(
+        _In_ std::shared_ptr<ReinitStatistics> statistics)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("warm reinit");
+
+    statistics->startPhase("read-maps");
+
+    readAsicState();
+
+    auto linecardKey = getLinecardKey();
+
+    if (linecardKey.empty() || m_vidToRidMap.empty())
+    {
+        SWSS_LOG_WARN("no previous linecard state in ASIC DB");
+
+        return nullptr;
+    }
+
+    statistics->startPhase("snapshot-load");
+
+    AsicStateSnapshot snapshot(m_client, m_asicKeys);
+
+    m_attributesLists = snapshot.load();
+
+    statistics->startPhase("linecard-bind");
+
+    bool bound = bindLinecard(linecardKey);
+
+    if (bound)
+    {
+        m_translator->preload(m_vidToRidMap, m_ridToVidMap);
+
+        statistics->startPhase("sample-check");
+
+        bound = checkSamples();
+    }
+
+    if (!bound)
+    {
+        if (m_linecardRid != OTAI_NULL_OBJECT_ID)
+        {
+            // leave vendor in the same state as before warm reinit attempt
+
+            m_vendorOtai->remove(OTAI_OBJECT_TYPE_LINECARD, m_linecardRid);
+        }
+
+        return nullptr;
+    }
+
+    auto linecard = std::make_shared<OtaiLinecard>(m_linecardVid, m_linecardRid, m_client, m_translator, m_vendorOtai);
+
+    // flex counters live in syncd memory only, so they are restored in the
+    // same way as on hard reinit
+
+    statistics->startPhase("flex-counter-group-restore");
+
+    auto flexCounterGroupKeys = m_client->getFlexCounterGroupKeys();
+    auto fgr = std::make_shared<FlexCounterGroupReiniter>(
+                m_client,
+                m_manager,
+                flexCounterGroupKeys);
+    fgr->hardReinit();
+
+    statistics->startPhase("flex-counter-restore");
+
+    auto flexCounterKeys = m_client->getFlexCounterKeys();
+    auto fr = std::make_shared<FlexCounterReiniter>(
+            m_client,
+            m_translator,
+            m_manager,
+            m_vidToRidMap,
+            m_ridToVidMap,
+            flexCounterKeys);
+    fr->hardReinit();
+
+    return linecard;
+}
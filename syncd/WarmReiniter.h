@@ -0,0 +1,111 @@
+#pragma once
+
+#include "meta/OtaiInterface.h"
+#include "OtaiLinecard.h"
+#include "VirtualOidTranslator.h"
+#include "RedisClient.h"
+#include "NotificationHandler.h"
+#include "FlexCounterManager.h"
+#include "ReinitStatistics.h"
+#include "AsicStateSnapshot.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+
+/*
+ * Number of objects of each object type which attributes are compared with
+ * hardware before warm reinit is accepted.
+ */
+#define WARM_REINIT_SAMPLES_PER_TYPE 2
+
+namespace syncd
+{
+    /**
+     * @brief Restores syncd state after restart without reprogramming hardware.
+     *
+     * VID/RID maps and ASIC view are taken from ASIC DB as they were left by
+     * previous syncd instance. Vendor library is attached to hardware by
+     * creating linecard with create only attributes, which must return the
+     * same RID as before, remaining RIDs are reused as they are. Small sample
+     * of objects is read back from hardware and compared with ASIC DB, any
+     * difference means hardware can't be trusted and hard reinit is needed.
+     */
+    class WarmReiniter
+    {
+        public:
+
+            typedef std::unordered_map<otai_object_id_t, otai_object_id_t> ObjectIdMap;
+
+        public:
+
+            WarmReiniter(
+                    _In_ std::shared_ptr<RedisClient> client,
+                    _In_ std::shared_ptr<VirtualOidTranslator> translator,
+                    _In_ std::shared_ptr<otairedis::OtaiInterface> otai,
+                    _In_ std::shared_ptr<NotificationHandler> handler,
+                    _In_ std::shared_ptr<FlexCounterManager> manager,
+                    _In_ const std::string& dbState);
+
+            virtual ~WarmReiniter();
+
+        public:
+
+            /**
+             * @brief Perform warm reinit.
+             *
+             * Returns NULL when previous state can't be reused, in that case
+             * linecard is removed again and caller should perform hard reinit.
+             */
+            std::shared_ptr<syncd::OtaiLinecard> warmReinit();
+
+        private:
+
+            std::shared_ptr<syncd::OtaiLinecard> warmReinit(
+                    _In_ std::shared_ptr<ReinitStatistics> statistics);
+
+            void readAsicState();
+
+            bool bindLinecard(
+                    _In_ const std::string& linecardKey);
+
+            bool checkSamples();
+
+            bool checkObject(
+                    _In_ const std::string& asicKey);
+
+            std::string getLinecardKey() const;
+
+            static otai_object_id_t getObjectIdFromAsicKey(
+                    _In_ const std::string& key);
+
+        private:
+
+            ObjectIdMap m_vidToRidMap;
+            ObjectIdMap m_ridToVidMap;
+
+            std::vector<std::string> m_asicKeys;
+
+            AsicStateSnapshot::AttributesLists m_attributesLists;
+
+            otai_object_id_t m_linecardVid;
+            otai_object_id_t m_linecardRid;
+
+            uint32_t m_sampledObjects;
+            uint32_t m_sampledAttributes;
+            uint32_t m_mismatches;
+
+            std::shared_ptr<otairedis::OtaiInterface> m_vendorOtai;
+
+            std::shared_ptr<VirtualOidTranslator> m_translator;
+
+            std::shared_ptr<RedisClient> m_client;
+
+            std::shared_ptr<NotificationHandler> m_handler;
+
+            std::shared_ptr<FlexCounterManager> m_manager;
+
+            std::string m_dbState;
+    };
+}
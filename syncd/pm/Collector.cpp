@@ -28,7 +28,8 @@ Collector::Collector(
     _In_ otai_object_type_t objectType,
     _In_ otai_object_id_t vid,
     _In_ otai_object_id_t rid,
-    std::shared_ptr<otairedis::OtaiInterface> vendorOtai) :
+    std::shared_ptr<otairedis::OtaiInterface> vendorOtai,
+    _In_ std::shared_ptr<otairedis::ContextConfig> contextConfig) :
     m_objectType(objectType),
     m_vid(vid),
     m_rid(rid),
@@ -36,9 +37,9 @@ Collector::Collector(
 {
     SWSS_LOG_ENTER();
 
-    m_stateDb = shared_ptr<swss::DBConnector>(new swss::DBConnector("STATE_DB", 0));
-    m_countersDb = shared_ptr<swss::DBConnector>(new swss::DBConnector("COUNTERS_DB", 0));
-    m_historyDb = shared_ptr<swss::DBConnector>(new swss::DBConnector(HISTORY_DB_NAME, 0));
+    m_stateDb = shared_ptr<swss::DBConnector>(new swss::DBConnector(contextConfig->m_dbState, 0));
+    m_countersDb = shared_ptr<swss::DBConnector>(new swss::DBConnector(contextConfig->m_dbCounters, 0));
+    m_historyDb = shared_ptr<swss::DBConnector>(new swss::DBConnector(contextConfig->m_dbHistory, 0));
 
     string strStateTable;
     string strCountersTable;
@@ -146,9 +147,8 @@ Collector::Collector(
 
     m_countersTableName = strCountersTable;
 
-    swss::DBConnector dbCounters("COUNTERS_DB", 0); 
     std::string strVid = otai_serialize_object_id(vid);
-    auto key = dbCounters.hget(strTableNameMap, strVid);
+    auto key = m_countersDb->hget(strTableNameMap, strVid);
     if (key != NULL)
     {
         m_stateTableKeyName = *key;
@@ -8,6 +8,7 @@
 #include "swss/table.h"
 #include "swss/logger.h"
 #include "meta/OtaiInterface.h"
+#include "ContextConfig.h"
 
 namespace syncd
 {
@@ -33,7 +34,8 @@ namespace syncd
             _In_ otai_object_type_t objectType,
             _In_ otai_object_id_t vid,
             _In_ otai_object_id_t rid,
-            std::shared_ptr<otairedis::OtaiInterface> vendorOtai);
+            std::shared_ptr<otairedis::OtaiInterface> vendorOtai,
+            _In_ std::shared_ptr<otairedis::ContextConfig> contextConfig);
 
         virtual ~Collector();
 
@@ -18,6 +18,7 @@ namespace syncd
             _In_ otai_object_id_t vid,
             _In_ otai_object_id_t rid,
             std::shared_ptr<otairedis::OtaiInterface> vendorOtai,
+            _In_ std::shared_ptr<otairedis::ContextConfig> contextConfig,
             _In_ const std::set<std::string> &strAttrIds);
 
         ~OtaiAttrCollector();
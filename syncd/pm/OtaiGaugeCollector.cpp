@@ -33,8 +33,9 @@ OtaiGaugeCollector::OtaiGaugeCollector(
             _In_ otai_object_id_t vid,
             _In_ otai_object_id_t rid,
             std::shared_ptr<otairedis::OtaiInterface> vendorOtai,
+            _In_ std::shared_ptr<otairedis::ContextConfig> contextConfig,
             _In_ const std::set<std::string> &strStatIds) :
-            Collector(objectType, vid, rid, vendorOtai)
+            Collector(objectType, vid, rid, vendorOtai, contextConfig)
 {
     SWSS_LOG_ENTER();
 
@@ -1,16 +1,90 @@
 #include "RequestShutdown.h"
+#include "ContextConfigContainer.h"
 
 #include "swss/logger.h"
 
+#include <getopt.h>
+
+#include <iostream>
+#include <cstdlib>
+#include <string>
+
 using namespace syncd;
 
+static void printUsage()
+{
+    SWSS_LOG_ENTER();
+
+    std::cout << "Usage: syncd_request_shutdown [-x file] [-g guid] [-h]" << std::endl;
+    std::cout << "    -x --contextConfig file" << std::endl;
+    std::cout << "        Context configuration file (json)" << std::endl;
+    std::cout << "    -g --globalContext guid" << std::endl;
+    std::cout << "        Guid of context from context configuration, default 0" << std::endl;
+    std::cout << "    -h --help" << std::endl;
+    std::cout << "        Print out this message" << std::endl;
+}
+
 int main(int argc, char **argv)
 {
     swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
 
     SWSS_LOG_ENTER();
 
-    RequestShutdown rs;
+    std::string contextConfig;
+
+    uint32_t globalContext = 0;
+
+    while (true)
+    {
+        static struct option long_options[] =
+        {
+            { "contextConfig",           required_argument, 0, 'x' },
+            { "globalContext",           required_argument, 0, 'g' },
+            { "help",                    no_argument,       0, 'h' },
+            { 0,                         0,                 0,  0  }
+        };
+
+        int option_index = 0;
+
+        int c = getopt_long(argc, argv, "x:g:h", long_options, &option_index);
+
+        if (c == -1)
+        {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'x':
+                contextConfig = std::string(optarg);
+                break;
+
+            case 'g':
+                globalContext = (uint32_t)std::strtoul(optarg, nullptr, 10);
+                break;
+
+            case 'h':
+                printUsage();
+                return EXIT_SUCCESS;
+
+            default:
+                printUsage();
+                return EXIT_FAILURE;
+        }
+    }
+
+    auto ccc = otairedis::ContextConfigContainer::loadFromFile(contextConfig.c_str());
+
+    auto cc = ccc->get(globalContext);
+
+    if (cc == nullptr)
+    {
+        std::cerr << "no context config defined at global context " << globalContext << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    RequestShutdown rs(cc);
 
     rs.send();
 
@@ -0,0 +1,108 @@
+#include "NotificationProcessor.h"
+#include "OcmSpectrum.h"
+
+#include "otairediscommon.h"
+
+#include "swss/dbconnector.h"
+#include "swss/logger.h"
+
+#include <vector>
+#include <cstring>
+#include <iostream>
+
+using namespace syncd;
+
+/*
+ * Spectrum is written under own OCM name, so test can run next to syncd.
+ */
+#define TEST_OCM_NAME "TEST_OCM_SPECTRUM"
+
+#define TEST_CHANNEL_COUNT 96
+
+/*
+ * 50 GHz grid from 191.3 THz in MHz, values have zero high bytes, so packed
+ * spectrum always contains zero bytes.
+ */
+#define TEST_FIRST_FREQUENCY 191300000ULL
+#define TEST_CHANNEL_WIDTH   50000ULL
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    SWSS_LOG_ENTER();
+
+    swss::DBConnector db("STATE_DB", 0);
+
+    std::string key = STATE_OT_OCM_TABLE_NAME "|" TEST_OCM_NAME "|" OCM_SPECTRUM_KEY_SUFFIX;
+
+    std::vector<otai_spectrum_power_t> channels(TEST_CHANNEL_COUNT);
+
+    for (uint32_t i = 0; i < TEST_CHANNEL_COUNT; i++)
+    {
+        channels[i].lower_frequency = TEST_FIRST_FREQUENCY + i * TEST_CHANNEL_WIDTH;
+        channels[i].upper_frequency = TEST_FIRST_FREQUENCY + (i + 1) * TEST_CHANNEL_WIDTH;
+        channels[i].power = (decltype(channels[i].power))(-30.0 + 0.25 * i);
+    }
+
+    otai_spectrum_power_list_t list;
+
+    list.count = TEST_CHANNEL_COUNT;
+    list.list = channels.data();
+
+    std::string data = OcmSpectrum::pack(list);
+
+    if (data.find('\0') == std::string::npos)
+    {
+        std::cerr << "packed spectrum has no zero byte, test doesn't cover truncation" << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    // same commands as compact spectrum write in NotificationProcessor
+
+    std::vector<swss::FieldValueTuple> values = {
+        { OCM_SPECTRUM_FIELD_ENCODING, OCM_SPECTRUM_ENCODING },
+        { OCM_SPECTRUM_FIELD_COUNT, std::to_string(list.count) },
+        { OCM_SPECTRUM_FIELD_DATA, data } };
+
+    std::vector<std::string> commands;
+
+    NotificationProcessor::addHmsetCommand(commands, key, values);
+    NotificationProcessor::addExpireCommand(commands, key, 60);
+
+    NotificationProcessor::pipelineCommands(db, commands);
+
+    auto entries = OcmSpectrum::read(db, TEST_OCM_NAME);
+
+    db.del(key);
+
+    if (entries.size() != TEST_CHANNEL_COUNT)
+    {
+        std::cerr << "expected " << TEST_CHANNEL_COUNT << " channels, read "
+            << entries.size() << " channels" << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    for (uint32_t i = 0; i < TEST_CHANNEL_COUNT; i++)
+    {
+        // power must be bit exact, compared as bytes
+
+        double power = (double)channels[i].power;
+
+        if (entries[i].m_lowerFrequency != channels[i].lower_frequency ||
+                entries[i].m_upperFrequency != channels[i].upper_frequency ||
+                memcmp(&entries[i].m_power, &power, sizeof(double)))
+        {
+            std::cerr << "channel " << i << " differs after write and read" << std::endl;
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::cout << "spectrum of " << TEST_CHANNEL_COUNT << " channels ("
+        << data.size() << " bytes) written and read back" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,191 @@
+#include "NotificationProcessor.h"
+#include "OtdrTrace.h"
+
+#include "meta/otai_serialize.h"
+
+#include "swss/dbconnector.h"
+#include "swss/logger.h"
+
+#include <vector>
+#include <cstring>
+#include <iostream>
+
+using namespace syncd;
+
+/*
+ * Scans are written under own key prefix, so test can run next to syncd.
+ */
+#define TEST_OTDR_KEY_PREFIX "TEST_OTDR_TRACE:"
+
+#define TEST_TRACE_SAMPLES 16000
+#define TEST_EVENT_COUNT   8
+
+static const char* g_encodings[] = {
+    OTDR_TRACE_ENCODING_TEXT,
+    OTDR_TRACE_ENCODING_RAW,
+    OTDR_TRACE_ENCODING_ZSTD };
+
+/*
+ * Trace of 16 bit samples with exponential decay and noise floor, low bytes
+ * of floor are zero, so trace and compressed trace contain zero bytes.
+ */
+static std::string makeTrace()
+{
+    SWSS_LOG_ENTER();
+
+    std::string trace;
+
+    trace.reserve(2 * TEST_TRACE_SAMPLES);
+
+    uint32_t level = 0xfff0;
+
+    for (uint32_t i = 0; i < TEST_TRACE_SAMPLES; i++)
+    {
+        uint32_t sample = (level > 0x0100) ? level : 0x0100;
+
+        trace.push_back((char)(sample & 0xff));
+        trace.push_back((char)((sample >> 8) & 0xff));
+
+        level -= level / 512;
+    }
+
+    return trace;
+}
+
+static bool checkEvents(
+        _In_ const std::vector<otai_otdr_event_t>& expected,
+        _In_ const std::vector<OtdrEventEntry>& actual)
+{
+    SWSS_LOG_ENTER();
+
+    if (expected.size() != actual.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        // values must be bit exact, compared as bytes
+
+        double values[4] = {
+            (double)expected[i].length,
+            (double)expected[i].loss,
+            (double)expected[i].reflection,
+            (double)expected[i].accumulate_loss };
+
+        double read[4] = {
+            actual[i].m_length,
+            actual[i].m_loss,
+            actual[i].m_reflection,
+            actual[i].m_accumulateLoss };
+
+        if (actual[i].m_type != (uint32_t)expected[i].type || memcmp(values, read, sizeof(values)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    SWSS_LOG_ENTER();
+
+    swss::DBConnector db("STATE_DB", 0);
+
+    std::string trace = makeTrace();
+
+    std::vector<otai_otdr_event_t> events(TEST_EVENT_COUNT);
+
+    for (uint32_t i = 0; i < TEST_EVENT_COUNT; i++)
+    {
+        events[i].type = (decltype(events[i].type))(i % 2);
+        events[i].length = (decltype(events[i].length))(1250.5 * (i + 1));
+        events[i].loss = (decltype(events[i].loss))(0.25 * i);
+        events[i].reflection = (decltype(events[i].reflection))(-45.5 - i);
+        events[i].accumulate_loss = (decltype(events[i].accumulate_loss))(0.5 * i);
+    }
+
+    otai_otdr_event_list_t list;
+
+    list.count = TEST_EVENT_COUNT;
+    list.list = events.data();
+
+    std::string packedEvents = OtdrTrace::packEvents(list);
+
+    bool ok = true;
+
+    for (auto encoding: g_encodings)
+    {
+        std::string key = TEST_OTDR_KEY_PREFIX + std::string(encoding);
+
+        std::string data = OtdrTrace::encodeTrace(trace, encoding);
+
+        // same fields and commands as binary OTDR write in
+        // NotificationProcessor, text entry has trace only
+
+        std::vector<swss::FieldValueTuple> values = { { "name", "TEST_OTDR" } };
+
+        if (std::string(encoding) != OTDR_TRACE_ENCODING_TEXT)
+        {
+            if (data.find('\0') == std::string::npos)
+            {
+                std::cerr << encoding << ": encoded trace has no zero byte, test doesn't cover truncation" << std::endl;
+
+                ok = false;
+            }
+
+            values.emplace_back(OTDR_FIELD_DATA_ENCODING, encoding);
+            values.emplace_back(OTDR_FIELD_DATA_SIZE, otai_serialize_number(trace.size()));
+            values.emplace_back(OTDR_FIELD_EVENT_COUNT, otai_serialize_number(list.count));
+            values.emplace_back(OTDR_FIELD_EVENTS, packedEvents);
+        }
+
+        values.emplace_back(OTDR_FIELD_DATA, data);
+
+        std::vector<std::string> commands;
+
+        NotificationProcessor::addDelCommand(commands, key);
+        NotificationProcessor::addHmsetCommand(commands, key, values);
+
+        NotificationProcessor::pipelineCommands(db, commands);
+
+        OtdrScan scan;
+
+        bool found = OtdrTrace::read(db, key, scan);
+
+        db.del(key);
+
+        if (!found)
+        {
+            std::cerr << encoding << ": scan not found" << std::endl;
+
+            ok = false;
+
+            continue;
+        }
+
+        if (scan.m_trace != trace)
+        {
+            std::cerr << encoding << ": trace of " << trace.size() << " bytes (" << data.size()
+                << " encoded) read back as " << scan.m_trace.size() << " bytes" << std::endl;
+
+            ok = false;
+        }
+
+        if (std::string(encoding) != OTDR_TRACE_ENCODING_TEXT && !checkEvents(events, scan.m_events))
+        {
+            std::cerr << encoding << ": events differ after write and read" << std::endl;
+
+            ok = false;
+        }
+
+        std::cout << encoding << ": trace of " << trace.size() << " bytes stored as "
+            << data.size() << " bytes" << std::endl;
+    }
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
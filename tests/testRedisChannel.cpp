@@ -0,0 +1,302 @@
+#include "RedisChannel.h"
+#include "Utils.h"
+#include "otairediscommon.h"
+
+#include "swss/dbconnector.h"
+#include "swss/consumertable.h"
+#include "swss/producertable.h"
+#include "swss/select.h"
+#include "swss/logger.h"
+
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <chrono>
+#include <iostream>
+
+using namespace otairedis;
+
+/*
+ * Test acts as syncd on own request and response tables in ASIC_DB, so it
+ * doesn't consume requests of syncd running on same redis.
+ */
+#define TEST_REQUEST_TABLE  "TEST_" ASIC_STATE_TABLE
+#define TEST_RESPONSE_TABLE "TEST_" REDIS_TABLE_GETRESPONSE
+
+/*
+ * Number of threads in pipelined phase.
+ */
+#define TEST_THREAD_COUNT 8
+
+/*
+ * Client thread counts for which serialized and concurrent requests are
+ * compared.
+ */
+static const size_t g_threadCounts[] = { 1, 2, 4, 8 };
+
+/*
+ * Serializes requests of all threads, as single API mutex did before
+ * requests were routed by request id, only one request is in flight.
+ */
+static std::mutex g_apiMutex;
+
+/*
+ * Number of synchronous requests sent by each thread.
+ */
+#define TEST_REQUEST_COUNT 2000
+
+/*
+ * Number of requests sent by each thread before waiting for all of their
+ * responses in pipelined phase.
+ */
+#define TEST_PIPELINE_DEPTH 100
+
+#define TEST_RESPONSE_STATUS "OTAI_STATUS_SUCCESS"
+
+/*
+ * Answers each batch of requests in reverse order, so responses arrive in
+ * different order than requests were sent and must be routed by request id.
+ */
+static void respond(
+        _In_ std::atomic<bool>& run)
+{
+    SWSS_LOG_ENTER();
+
+    swss::DBConnector db("ASIC_DB", 0);
+
+    swss::ConsumerTable requests(&db, TEST_REQUEST_TABLE);
+    swss::ProducerTable responses(&db, TEST_RESPONSE_TABLE);
+
+    requests.setModifyRedis(false);
+
+    swss::Select s;
+
+    s.addSelectable(&requests);
+
+    while (run)
+    {
+        swss::Selectable *sel = nullptr;
+
+        if (s.select(&sel, 100) != swss::Select::OBJECT)
+        {
+            continue;
+        }
+
+        std::deque<swss::KeyOpFieldsValuesTuple> vkco;
+
+        requests.pops(vkco);
+
+        for (auto it = vkco.rbegin(); it != vkco.rend(); it++)
+        {
+            uint64_t requestId;
+
+            auto key = Utils::splitRequestId(kfvKey(*it), requestId);
+
+            std::vector<swss::FieldValueTuple> values = { swss::FieldValueTuple("key", key) };
+
+            responses.set(
+                    Utils::joinRequestId(TEST_RESPONSE_STATUS, requestId),
+                    values,
+                    REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+        }
+    }
+}
+
+static bool checkResponse(
+        _In_ const swss::KeyOpFieldsValuesTuple& kco,
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    auto& values = kfvFieldsValues(kco);
+
+    if (kfvKey(kco) != TEST_RESPONSE_STATUS || values.size() != 1 || fvValue(values[0]) != key)
+    {
+        std::cerr << "request " << key << " got wrong response "
+            << kfvKey(kco) << " " << (values.size() ? fvValue(values[0]) : "") << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+static std::string makeKey(
+        _In_ size_t thread,
+        _In_ size_t idx)
+{
+    SWSS_LOG_ENTER();
+
+    return "OTAI_OBJECT_TYPE_PORT:oid:0x" + std::to_string(thread) + "_" + std::to_string(idx);
+}
+
+static void sendSynchronous(
+        _In_ std::shared_ptr<RedisChannel> channel,
+        _In_ size_t thread,
+        _Inout_ std::atomic<size_t>& failed)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values = { swss::FieldValueTuple("NULL", "NULL") };
+
+    for (size_t idx = 0; idx < TEST_REQUEST_COUNT; idx++)
+    {
+        auto key = makeKey(thread, idx);
+
+        auto requestId = channel->set(key, values, REDIS_ASIC_STATE_COMMAND_CREATE);
+
+        swss::KeyOpFieldsValuesTuple kco;
+
+        channel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, requestId, kco);
+
+        if (!checkResponse(kco, key))
+        {
+            failed++;
+        }
+    }
+}
+
+static void sendSerialized(
+        _In_ std::shared_ptr<RedisChannel> channel,
+        _In_ size_t thread,
+        _Inout_ std::atomic<size_t>& failed)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values = { swss::FieldValueTuple("NULL", "NULL") };
+
+    for (size_t idx = 0; idx < TEST_REQUEST_COUNT; idx++)
+    {
+        auto key = makeKey(thread, idx);
+
+        std::lock_guard<std::mutex> lock(g_apiMutex);
+
+        auto requestId = channel->set(key, values, REDIS_ASIC_STATE_COMMAND_CREATE);
+
+        swss::KeyOpFieldsValuesTuple kco;
+
+        channel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, requestId, kco);
+
+        if (!checkResponse(kco, key))
+        {
+            failed++;
+        }
+    }
+}
+
+static void sendPipelined(
+        _In_ std::shared_ptr<RedisChannel> channel,
+        _In_ size_t thread,
+        _Inout_ std::atomic<size_t>& failed)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values = { swss::FieldValueTuple("NULL", "NULL") };
+
+    for (size_t idx = 0; idx < TEST_REQUEST_COUNT; idx += TEST_PIPELINE_DEPTH)
+    {
+        std::vector<uint64_t> requestIds;
+        std::vector<std::string> keys;
+
+        for (size_t i = idx; i < idx + TEST_PIPELINE_DEPTH && i < TEST_REQUEST_COUNT; i++)
+        {
+            keys.push_back(makeKey(thread, i));
+
+            requestIds.push_back(channel->set(keys.back(), values, REDIS_ASIC_STATE_COMMAND_SET));
+        }
+
+        std::vector<swss::KeyOpFieldsValuesTuple> kcos;
+
+        channel->waitForResponses(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, requestIds, kcos);
+
+        if (kcos.size() != keys.size())
+        {
+            std::cerr << "thread " << thread << " got " << kcos.size() << " responses, expected " << keys.size() << std::endl;
+
+            failed += keys.size();
+
+            continue;
+        }
+
+        for (size_t i = 0; i < keys.size(); i++)
+        {
+            if (!checkResponse(kcos[i], keys[i]))
+            {
+                failed++;
+            }
+        }
+    }
+}
+
+static bool runPhase(
+        _In_ const std::string& name,
+        _In_ std::shared_ptr<RedisChannel> channel,
+        _In_ size_t threadCount,
+        _In_ void (*fun)(std::shared_ptr<RedisChannel>, size_t, std::atomic<size_t>&))
+{
+    SWSS_LOG_ENTER();
+
+    std::atomic<size_t> failed(0);
+
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back(fun, channel, t, std::ref(failed));
+    }
+
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    size_t total = threadCount * TEST_REQUEST_COUNT;
+
+    std::cout << name << ": " << total << " requests from " << threadCount << " threads in "
+        << ms << " ms, " << (ms ? (total * 1000 / (size_t)ms) : total) << " requests/s, "
+        << failed << " failed" << std::endl;
+
+    return failed == 0;
+}
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    SWSS_LOG_ENTER();
+
+    std::atomic<bool> run(true);
+
+    std::thread responder(respond, std::ref(run));
+
+    auto channel = std::make_shared<RedisChannel>("ASIC_DB", TEST_REQUEST_TABLE, TEST_RESPONSE_TABLE,
+            [](const std::vector<swss::KeyOpFieldsValuesTuple>&) {});
+
+    bool success = true;
+
+    // throughput of requests serialized by single lock against requests
+    // sent concurrently and routed by request id
+
+    for (auto threadCount: g_threadCounts)
+    {
+        success = runPhase("serialized", channel, threadCount, sendSerialized) && success;
+        success = runPhase("concurrent", channel, threadCount, sendSynchronous) && success;
+    }
+
+    channel->setBuffered(true);
+
+    success = runPhase("pipelined", channel, TEST_THREAD_COUNT, sendPipelined) && success;
+
+    channel = nullptr;
+
+    run = false;
+
+    responder.join();
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
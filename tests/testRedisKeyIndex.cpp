@@ -0,0 +1,391 @@
+#include "RedisKeyIndex.h"
+#include "RedisClient.h"
+
+#include "swss/dbconnector.h"
+#include "swss/rediscommand.h"
+#include "swss/redisreply.h"
+#include "swss/logger.h"
+
+#include <set>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+using namespace syncd;
+
+/*
+ * Index and keys use own prefix, so test can run next to syncd.
+ */
+#define TEST_INDEX_NAME "TEST_KEY_INDEX"
+#define TEST_KEY_PREFIX "TEST_KEY_INDEX_DATA:"
+
+#define TEST_BUCKET_COUNT 5
+
+/*
+ * More than single SCAN and SADD batch.
+ */
+#define TEST_KEY_COUNT 2500
+
+/*
+ * Default number of keys in benchmark, can be given as first argument.
+ */
+#define TEST_BENCHMARK_KEY_COUNT 1000000
+
+/*
+ * Number of keys written or deleted by single pipeline.
+ */
+#define TEST_PIPELINE_KEY_COUNT 10000
+
+static std::string getBucket(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    // TEST_KEY_INDEX_DATA:<bucket>:<n>
+
+    size_t start = key.find(':') + 1;
+
+    return key.substr(start, key.find(':', start) - start);
+}
+
+static std::string makeKey(
+        _In_ size_t bucket,
+        _In_ const std::string& name)
+{
+    SWSS_LOG_ENTER();
+
+    return TEST_KEY_PREFIX "bucket" + std::to_string(bucket) + ":" + name;
+}
+
+static std::shared_ptr<RedisKeyIndex> createIndex(
+        _In_ std::shared_ptr<swss::DBConnector> db)
+{
+    SWSS_LOG_ENTER();
+
+    return std::make_shared<RedisKeyIndex>(db, TEST_INDEX_NAME, TEST_KEY_PREFIX "*", &getBucket);
+}
+
+static std::string formatCommand(
+        _In_ const std::vector<std::string>& args)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<const char*> argv;
+    std::vector<size_t> argvlen;
+
+    for (auto& arg: args)
+    {
+        argv.push_back(arg.c_str());
+        argvlen.push_back(arg.size());
+    }
+
+    swss::RedisCommand cmd;
+
+    cmd.formatArgv((int)argv.size(), argv.data(), argvlen.data());
+
+    return std::string(cmd.c_str(), cmd.length());
+}
+
+static void cleanup(
+        _In_ swss::DBConnector& db)
+{
+    SWSS_LOG_ENTER();
+
+    // removes keys, bucket sets, index set and valid marker
+
+    auto keys = RedisKeyIndex::scanKeys(db, TEST_INDEX_NAME "*");
+
+    for (size_t idx = 0; idx < keys.size(); idx += TEST_PIPELINE_KEY_COUNT)
+    {
+        std::vector<std::string> args = { "DEL" };
+
+        args.insert(args.end(), keys.begin() + (long)idx, keys.begin() + (long)std::min(keys.size(), idx + TEST_PIPELINE_KEY_COUNT));
+
+        RedisClient::pipelineCommands(db, { formatCommand(args) });
+    }
+}
+
+/*
+ * Measures round trip of PING sent back to back from own connection, so
+ * time for which redis doesn't serve other clients is visible.
+ */
+class PingMonitor
+{
+    public:
+
+        PingMonitor():
+            m_run(true),
+            m_maxLatencyUs(0),
+            m_count(0)
+        {
+            SWSS_LOG_ENTER();
+
+            m_thread = std::thread(&PingMonitor::run, this);
+        }
+
+        uint64_t stop()
+        {
+            SWSS_LOG_ENTER();
+
+            m_run = false;
+
+            m_thread.join();
+
+            return m_maxLatencyUs;
+        }
+
+    private:
+
+        void run()
+        {
+            SWSS_LOG_ENTER();
+
+            swss::DBConnector db("ASIC_DB", 0);
+
+            swss::RedisCommand ping;
+
+            ping.format("PING");
+
+            while (m_run)
+            {
+                auto start = std::chrono::steady_clock::now();
+
+                swss::RedisReply r(&db, ping, REDIS_REPLY_STATUS);
+
+                auto us = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+                m_maxLatencyUs = std::max(m_maxLatencyUs.load(), us);
+
+                m_count++;
+            }
+        }
+
+        std::atomic<bool> m_run;
+
+        std::atomic<uint64_t> m_maxLatencyUs;
+
+        std::atomic<uint64_t> m_count;
+
+        std::thread m_thread;
+};
+
+template <typename F>
+static void measure(
+        _In_ const std::string& name,
+        _In_ F fun)
+{
+    SWSS_LOG_ENTER();
+
+    PingMonitor monitor;
+
+    auto start = std::chrono::steady_clock::now();
+
+    size_t count = fun();
+
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    uint64_t maxLatencyUs = monitor.stop();
+
+    std::cout << name << ": " << count << " keys in " << ms << " ms, max concurrent PING latency "
+        << maxLatencyUs << " us" << std::endl;
+}
+
+/*
+ * Compares blocking of redis by KEYS, which index replaced, with index
+ * rebuild and index read on large keyspace.
+ */
+static bool benchmark(
+        _In_ std::shared_ptr<swss::DBConnector> db,
+        _In_ size_t keyCount)
+{
+    SWSS_LOG_ENTER();
+
+    cleanup(*db);
+
+    for (size_t idx = 0; idx < keyCount; idx += TEST_PIPELINE_KEY_COUNT)
+    {
+        std::vector<std::string> commands;
+
+        for (size_t i = idx; i < std::min(keyCount, idx + TEST_PIPELINE_KEY_COUNT); i++)
+        {
+            commands.push_back(formatCommand({ "HSET", makeKey(i % TEST_BUCKET_COUNT, std::to_string(i)), "NULL", "NULL" }));
+        }
+
+        RedisClient::pipelineCommands(*db, commands);
+    }
+
+    measure("KEYS", [&]() {
+            swss::RedisCommand keys;
+
+            keys.format("KEYS %s", TEST_KEY_PREFIX "*");
+
+            swss::RedisReply r(db.get(), keys, REDIS_REPLY_ARRAY);
+
+            return r.getContext()->elements;
+            });
+
+    size_t rebuilt = 0;
+
+    measure("index rebuild", [&]() {
+            rebuilt = createIndex(db)->getKeys().size();
+
+            return rebuilt;
+            });
+
+    size_t indexed = 0;
+
+    measure("index read", [&]() {
+            indexed = createIndex(db)->getKeys().size();
+
+            return indexed;
+            });
+
+    cleanup(*db);
+
+    if (rebuilt != keyCount || indexed != keyCount)
+    {
+        std::cerr << "benchmark index returned " << rebuilt << " and " << indexed << " keys, expected "
+            << keyCount << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+static bool check(
+        _In_ const std::string& name,
+        _In_ const std::vector<std::string>& keys,
+        _In_ const std::set<std::string>& expected)
+{
+    SWSS_LOG_ENTER();
+
+    std::set<std::string> actual(keys.begin(), keys.end());
+
+    if (actual.size() != keys.size())
+    {
+        std::cerr << name << ": index returned duplicated keys" << std::endl;
+
+        return false;
+    }
+
+    if (actual != expected)
+    {
+        std::cerr << name << ": expected " << expected.size() << " keys, index returned "
+            << actual.size() << " keys" << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    SWSS_LOG_ENTER();
+
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    cleanup(*db);
+
+    // keys written before index existed, first read must rebuild index
+
+    std::set<std::string> expected;
+    std::set<std::string> bucket0;
+
+    for (size_t idx = 0; idx < TEST_KEY_COUNT; idx++)
+    {
+        auto key = makeKey(idx % TEST_BUCKET_COUNT, std::to_string(idx));
+
+        db->hset(key, "NULL", "NULL");
+
+        expected.insert(key);
+
+        if (idx % TEST_BUCKET_COUNT == 0)
+        {
+            bucket0.insert(key);
+        }
+    }
+
+    bool ok = true;
+
+    auto index = createIndex(db);
+
+    ok &= check("rebuild", index->getKeys(), expected);
+    ok &= check("rebuild bucket", index->getKeys("bucket0"), bucket0);
+
+    if (!db->exists(TEST_INDEX_NAME "_VALID"))
+    {
+        std::cerr << "index valid marker not set after rebuild" << std::endl;
+
+        ok = false;
+    }
+
+    // writers keep index up to date
+
+    auto inserted = makeKey(TEST_BUCKET_COUNT, "inserted");
+
+    db->hset(inserted, "NULL", "NULL");
+
+    index->insert(inserted);
+
+    expected.insert(inserted);
+
+    auto removed = *bucket0.begin();
+
+    db->del(removed);
+
+    index->remove(removed);
+
+    expected.erase(removed);
+    bucket0.erase(removed);
+
+    ok &= check("insert and remove", index->getKeys(), expected);
+    ok &= check("remove from bucket", index->getKeys("bucket0"), bucket0);
+
+    // valid index is used as is, key written without index is not listed
+
+    auto unindexed = makeKey(0, "unindexed");
+
+    db->hset(unindexed, "NULL", "NULL");
+
+    ok &= check("valid index", createIndex(db)->getKeys(), expected);
+
+    // index is rebuilt from keys when marker is missing
+
+    db->del(TEST_INDEX_NAME "_VALID");
+
+    expected.insert(unindexed);
+
+    ok &= check("rebuild after marker removal", createIndex(db)->getKeys(), expected);
+
+    // bucket removal keeps other buckets
+
+    index->removeBucket("bucket1");
+
+    for (auto it = expected.begin(); it != expected.end();)
+    {
+        it = (getBucket(*it) == "bucket1") ? expected.erase(it) : std::next(it);
+    }
+
+    ok &= check("remove bucket", index->getKeys(), expected);
+
+    cleanup(*db);
+
+    if (!ok)
+    {
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "index of " << TEST_KEY_COUNT << " keys in " << TEST_BUCKET_COUNT
+        << " buckets rebuilt and updated" << std::endl;
+
+    size_t keyCount = (argc > 1) ? std::stoul(argv[1]) : TEST_BENCHMARK_KEY_COUNT;
+
+    return benchmark(db, keyCount) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
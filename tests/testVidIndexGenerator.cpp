@@ -0,0 +1,256 @@
+#include "RedisVidIndexGenerator.h"
+
+#include "swss/dbconnector.h"
+#include "swss/logger.h"
+
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include <cstring>
+#include <cerrno>
+#include <thread>
+#include <vector>
+#include <set>
+#include <iostream>
+
+using namespace otairedis;
+
+/*
+ * Counter used instead of VIDCOUNTER, so test can run next to syncd.
+ */
+#define TEST_VID_COUNTER "TEST_VIDCOUNTER"
+
+#define TEST_THREAD_COUNT 4
+
+/*
+ * Number of indexes allocated by each thread.
+ */
+#define TEST_INDEX_COUNT 20000
+
+/*
+ * Generator is reset after this many allocations in first thread of each
+ * process, to abandon partially used ranges.
+ */
+#define TEST_RESET_INTERVAL 1000
+
+/*
+ * Each process simulates separate client or syncd with own block size, size 1
+ * is plain INCR.
+ */
+static const uint64_t g_blockSizes[] = { 1, 7, 64, REDIS_VID_INDEX_BLOCK_SIZE, 1000 };
+
+#define TEST_PROCESS_COUNT (sizeof(g_blockSizes)/sizeof(g_blockSizes[0]))
+
+static bool writeAll(
+        _In_ int fd,
+        _In_ const void* buffer,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    auto ptr = static_cast<const uint8_t*>(buffer);
+
+    while (size)
+    {
+        ssize_t written = write(fd, ptr, size);
+
+        if (written <= 0)
+        {
+            return false;
+        }
+
+        ptr += written;
+        size -= (size_t)written;
+    }
+
+    return true;
+}
+
+/*
+ * Allocates indexes from multiple threads sharing one generator and writes
+ * them to pipe.
+ */
+static int allocateIndexes(
+        _In_ uint64_t blockSize,
+        _In_ int fd)
+{
+    SWSS_LOG_ENTER();
+
+    // connection is created after fork, each process is separate redis client
+
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    auto generator = std::make_shared<RedisVidIndexGenerator>(db, TEST_VID_COUNTER, blockSize);
+
+    std::vector<std::vector<uint64_t>> indexes(TEST_THREAD_COUNT);
+
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < TEST_THREAD_COUNT; t++)
+    {
+        threads.emplace_back([&generator, &indexes, t]() {
+
+                auto& list = indexes[t];
+
+                list.reserve(TEST_INDEX_COUNT);
+
+                for (size_t idx = 0; idx < TEST_INDEX_COUNT; idx++)
+                {
+                    if (t == 0 && idx && idx % TEST_RESET_INTERVAL == 0)
+                    {
+                        generator->reset();
+                    }
+
+                    list.push_back(generator->increment());
+                }
+            });
+    }
+
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    for (auto& list: indexes)
+    {
+        if (!writeAll(fd, list.data(), list.size() * sizeof(uint64_t)))
+        {
+            std::cerr << "failed to write indexes: " << strerror(errno) << std::endl;
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    SWSS_LOG_ENTER();
+
+    swss::DBConnector db("ASIC_DB", 0);
+
+    db.del(TEST_VID_COUNTER);
+
+    std::vector<pid_t> pids;
+    std::vector<int> fds;
+
+    for (size_t p = 0; p < TEST_PROCESS_COUNT; p++)
+    {
+        int pipefd[2];
+
+        if (pipe(pipefd) != 0)
+        {
+            std::cerr << "pipe failed: " << strerror(errno) << std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        pid_t pid = fork();
+
+        if (pid < 0)
+        {
+            std::cerr << "fork failed: " << strerror(errno) << std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        if (pid == 0)
+        {
+            close(pipefd[0]);
+
+            int status = allocateIndexes(g_blockSizes[p], pipefd[1]);
+
+            close(pipefd[1]);
+
+            _exit(status);
+        }
+
+        close(pipefd[1]);
+
+        pids.push_back(pid);
+        fds.push_back(pipefd[0]);
+    }
+
+    std::set<uint64_t> allocated;
+
+    size_t duplicates = 0;
+    size_t total = 0;
+
+    for (size_t p = 0; p < TEST_PROCESS_COUNT; p++)
+    {
+        uint64_t index;
+
+        while (read(fds[p], &index, sizeof(index)) == (ssize_t)sizeof(index))
+        {
+            total++;
+
+            if (index == 0 || !allocated.insert(index).second)
+            {
+                if (duplicates++ < 10)
+                {
+                    std::cerr << "index " << index << " is invalid or allocated more than once (block size "
+                        << g_blockSizes[p] << ")" << std::endl;
+                }
+            }
+        }
+
+        close(fds[p]);
+    }
+
+    bool failed = false;
+
+    for (auto pid: pids)
+    {
+        int status = 0;
+
+        if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+        {
+            std::cerr << "allocating process " << pid << " failed" << std::endl;
+
+            failed = true;
+        }
+    }
+
+    size_t expected = TEST_PROCESS_COUNT * TEST_THREAD_COUNT * TEST_INDEX_COUNT;
+
+    if (total != expected)
+    {
+        std::cerr << "expected " << expected << " indexes, got " << total << std::endl;
+
+        failed = true;
+    }
+
+    if (duplicates)
+    {
+        std::cerr << duplicates << " invalid or duplicated indexes" << std::endl;
+
+        failed = true;
+    }
+
+    // every handed out index must be below counter, so later allocators
+    // will not collide with it
+
+    auto counter = db.get(TEST_VID_COUNTER);
+
+    if (!counter || allocated.empty() || std::stoull(*counter) < *allocated.rbegin())
+    {
+        std::cerr << "VID counter is behind allocated indexes" << std::endl;
+
+        failed = true;
+    }
+
+    db.del(TEST_VID_COUNTER);
+
+    if (failed)
+    {
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "allocated " << total << " unique indexes by " << TEST_PROCESS_COUNT
+        << " processes with " << TEST_THREAD_COUNT << " threads each" << std::endl;
+
+    return EXIT_SUCCESS;
+}
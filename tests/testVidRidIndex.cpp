@@ -0,0 +1,261 @@
+#include "VidRidIndex.h"
+
+#include "swss/logger.h"
+
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <chrono>
+#include <iostream>
+
+using namespace syncd;
+
+/*
+ * Number of objects in index while readers are running.
+ */
+#define TEST_OBJECT_COUNT 100000
+
+/*
+ * Index sizes for which cost of single write is measured.
+ */
+static const size_t g_writeSizes[] = { 1000, 10000, 100000 };
+
+#define TEST_WRITE_COUNT 2000
+
+static const size_t g_readerCounts[] = { 1, 2, 4, 8 };
+
+#define TEST_DURATION_MS 500
+
+/*
+ * Same layout as VirtualObjectIdManager, linecard index, object type and
+ * object index from counter shared by all types.
+ */
+static otai_object_id_t makeVid(
+        _In_ uint64_t index)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t objectType = 1 + index % 16;
+
+    return (otai_object_id_t)((objectType << 48) | index);
+}
+
+static otai_object_id_t makeRid(
+        _In_ uint64_t index)
+{
+    SWSS_LOG_ENTER();
+
+    // vendor RIDs are usually aligned pointers
+
+    return (otai_object_id_t)(0x7f0000000000ULL + index * 64);
+}
+
+static std::shared_ptr<VidRidIndex> createIndex(
+        _In_ size_t count)
+{
+    SWSS_LOG_ENTER();
+
+    auto index = std::make_shared<VidRidIndex>();
+
+    for (uint64_t idx = 1; idx <= count; idx++)
+    {
+        index->insert(makeVid(idx), makeRid(idx));
+    }
+
+    return index;
+}
+
+/*
+ * Measures copy, insert and publish as done by VirtualOidTranslator for each
+ * created object, cost must not grow with index size.
+ */
+static double measureWrite(
+        _In_ size_t count)
+{
+    SWSS_LOG_ENTER();
+
+    std::shared_ptr<const VidRidIndex> published = createIndex(count);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint64_t idx = 1; idx <= TEST_WRITE_COUNT; idx++)
+    {
+        auto index = std::make_shared<VidRidIndex>(*std::atomic_load(&published));
+
+        index->insert(makeVid(count + idx), makeRid(count + idx));
+
+        std::shared_ptr<const VidRidIndex> copy = index;
+
+        std::atomic_store(&published, copy);
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / TEST_WRITE_COUNT;
+}
+
+/*
+ * Readers translate preloaded objects in both directions while writer
+ * creates and removes other objects. With locked is false readers use
+ * published snapshot like VirtualOidTranslator, otherwise readers and writer
+ * share single index under mutex.
+ */
+static bool measureRead(
+        _In_ size_t readerCount,
+        _In_ bool locked,
+        _Out_ double& readsPerSecond,
+        _Out_ double& writesPerSecond)
+{
+    SWSS_LOG_ENTER();
+
+    std::shared_ptr<const VidRidIndex> published = createIndex(TEST_OBJECT_COUNT);
+
+    auto shared = createIndex(TEST_OBJECT_COUNT);
+
+    std::mutex mutex;
+
+    std::atomic<bool> run(true);
+    std::atomic<uint64_t> reads(0);
+    std::atomic<uint64_t> failures(0);
+
+    uint64_t writes = 0;
+
+    std::vector<std::thread> readers;
+
+    for (size_t r = 0; r < readerCount; r++)
+    {
+        readers.emplace_back([&, r]() {
+
+                uint64_t count = 0;
+                uint64_t failed = 0;
+
+                uint64_t idx = 1 + r * 7919;
+
+                while (run.load(std::memory_order_relaxed))
+                {
+                    idx = 1 + (idx * 2654435761ULL) % TEST_OBJECT_COUNT;
+
+                    otai_object_id_t rid;
+                    otai_object_id_t vid;
+
+                    bool found;
+
+                    if (locked)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+
+                        found = shared->tryGetRid(makeVid(idx), rid) && shared->tryGetVid(rid, vid);
+                    }
+                    else
+                    {
+                        auto snapshot = std::atomic_load(&published);
+
+                        found = snapshot->tryGetRid(makeVid(idx), rid) && snapshot->tryGetVid(rid, vid);
+                    }
+
+                    if (!found || rid != makeRid(idx) || vid != makeVid(idx))
+                    {
+                        failed++;
+                    }
+
+                    count++;
+                }
+
+                reads += count;
+                failures += failed;
+            });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto deadline = start + std::chrono::milliseconds(TEST_DURATION_MS);
+
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        // objects above preloaded range are created and removed
+
+        uint64_t idx = TEST_OBJECT_COUNT + 1 + writes % 1000;
+
+        if (locked)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            if (writes % 2000 < 1000)
+                shared->insert(makeVid(idx), makeRid(idx));
+            else
+                shared->erase(makeVid(idx), makeRid(idx));
+        }
+        else
+        {
+            auto index = std::make_shared<VidRidIndex>(*std::atomic_load(&published));
+
+            if (writes % 2000 < 1000)
+                index->insert(makeVid(idx), makeRid(idx));
+            else
+                index->erase(makeVid(idx), makeRid(idx));
+
+            std::shared_ptr<const VidRidIndex> copy = index;
+
+            std::atomic_store(&published, copy);
+        }
+
+        writes++;
+    }
+
+    run = false;
+
+    for (auto& reader: readers)
+    {
+        reader.join();
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    readsPerSecond = (double)reads.load() / seconds;
+    writesPerSecond = (double)writes / seconds;
+
+    if (failures.load())
+    {
+        std::cerr << failures.load() << " lookups of preloaded objects failed with "
+            << readerCount << " readers" << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    SWSS_LOG_ENTER();
+
+    for (auto count: g_writeSizes)
+    {
+        std::cout << "copy, insert and publish with " << count << " objects: "
+            << (uint64_t)measureWrite(count) << " ns" << std::endl;
+    }
+
+    bool failed = false;
+
+    for (auto readerCount: g_readerCounts)
+    {
+        for (bool locked: { false, true })
+        {
+            double readsPerSecond;
+            double writesPerSecond;
+
+            if (!measureRead(readerCount, locked, readsPerSecond, writesPerSecond))
+            {
+                failed = true;
+            }
+
+            std::cout << readerCount << " readers, " << (locked ? "mutex   " : "snapshot") << ": "
+                << (uint64_t)readsPerSecond << " lookups/s, "
+                << (uint64_t)writesPerSecond << " writes/s" << std::endl;
+        }
+    }
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}